@@ -1,11 +1,14 @@
 #include <benchmark/benchmark.h>
 
+#include "frenetTransform/arcChain.h"
+#include "frenetTransform/clothoidSpline.h"
 #include "frenetTransform/internal/circle.h"
 #include "frenetTransform/internal/constexprTypes.h"
 #include "frenetTransform/internal/transformCircle.h"
 #include "frenetTransform/point.h"
 #include "frenetTransform/points.h"
 #include "frenetTransform/polychain.h"
+#include "frenetTransform/spline.h"
 
 namespace FrenetTransform {
 namespace Internal {
@@ -17,6 +20,7 @@ protected:
 
   using ArrayQueries = Eigen::Array<double, Params::s_vals[1], 1>;
   using ArrayPoints = Eigen::Array<double, Params::s_vals[0], 1>;
+  using PointsFloat = Points<numQueries, BasicPoint<float>>;
 
   const Circle<numQueries> m_circle{5.0, {0.0, 0.0}, -M_PI};
   const TransformCircle<numQueries> m_transform{
@@ -32,8 +36,32 @@ protected:
   Points<numQueries> m_velCartes{};
   Points<numQueries> m_accCartes{};
 
+  // query points rounded to single precision
+  PointsFloat m_posFrenetFloat{};
+  PointsFloat m_velFrenetFloat{};
+  PointsFloat m_accFrenetFloat{};
+  PointsFloat m_posCartesFloat{};
+  PointsFloat m_velCartesFloat{};
+  PointsFloat m_accCartesFloat{};
+
+  static constexpr double s_hintWindow{0.1};
+  static constexpr double s_rasterResolution{0.1};
+  static constexpr int s_numBatches{16};
+
   Polychain<numPoints, numQueries> m_circlePoly{};
   Transform<numQueries> m_circleTransform{};
+  // path bound at compile time
+  Transform<numQueries, Polychain<numPoints, numQueries>>
+      m_circleTransformStatic{};
+  // single precision queries on the same polychain
+  Transform<numQueries, Path<numQueries, float>> m_circleTransformFloat{};
+  // spline through the points of the polychain
+  Transform<numQueries, Spline<numQueries>> m_circleTransformSpline{};
+  // arcs of constant curvature between the points of the polychain
+  Transform<numQueries, ClothoidSpline<numQueries>>
+      m_circleTransformClothoid{};
+  // circular arcs between the points of the polychain
+  Transform<numQueries, ArcChain<numQueries>> m_circleTransformArcs{};
 
   void SetUp(::benchmark::State &state) {
     std::srand(0);
@@ -78,28 +106,85 @@ protected:
     m_circlePoly = Polychain<numPoints, numQueries>{m_circleApprox(m_lengths)};
     m_circleTransform = Transform<numQueries>{
         std::make_shared<Polychain<numPoints, numQueries>>(m_circlePoly)};
+    m_circleTransformStatic =
+        Transform<numQueries, Polychain<numPoints, numQueries>>{
+            std::make_shared<Polychain<numPoints, numQueries>>(m_circlePoly)};
+    m_circleTransformFloat = Transform<numQueries, Path<numQueries, float>>{
+        std::make_shared<Polychain<numPoints, numQueries, float>>(
+            m_circleApprox(m_lengths))};
+    const Points<numPoints> points{m_circleApprox(m_lengths)};
+    m_circleTransformSpline = Transform<numQueries, Spline<numQueries>>{
+        std::make_shared<Spline<numQueries>>(points.x(), points.y())};
+    m_circleTransformClothoid =
+        Transform<numQueries, ClothoidSpline<numQueries>>{
+            std::make_shared<ClothoidSpline<numQueries>>(
+                points(0), -M_PI / 2, Eigen::ArrayXd{m_lengths},
+                Eigen::ArrayXd::Constant(m_lengths.rows(),
+                                         1 / m_circleApprox.radius()))};
+    m_circleTransformArcs = Transform<numQueries, ArcChain<numQueries>>{
+        std::make_shared<ArcChain<numQueries>>(
+            points(0), -M_PI / 2, Eigen::ArrayXd{m_lengths},
+            Eigen::ArrayXd::Constant(m_lengths.rows() - 1,
+                                     1 / m_circleApprox.radius()))};
+
+    m_posFrenetFloat = toFloat(m_posFrenet);
+    m_velFrenetFloat = toFloat(m_velFrenet);
+    m_accFrenetFloat = toFloat(m_accFrenet);
+    m_posCartesFloat = toFloat(m_posCartes);
+    m_velCartesFloat = toFloat(m_velCartes);
+    m_accCartesFloat = toFloat(m_accCartes);
+  }
+
+  static PointsFloat toFloat(const Points<numQueries> &points) {
+    return {points.x().template cast<float>(),
+            points.y().template cast<float>()};
   }
 
-  template <typename Tpoint>
-  void reportError(const Points<numQueries, Tpoint> diff,
+  static Points<numQueries> toDouble(const PointsFloat &points) {
+    return {points.x().template cast<double>(),
+            points.y().template cast<double>()};
+  }
+
+  template <typename Derived, typename Tpoint>
+  void reportError(const PointsBase<Derived, Tpoint> &diff,
                    benchmark::State &state) {
-    Eigen::ArrayXd errX{diff.x().abs()};
+    Eigen::ArrayXd errX{diff.derived().x().abs()};
     std::sort(errX.begin(), errX.end());
     state.counters["ErrMaxX"] = errX(errX.rows() - 1);
     state.counters["ErrMedX"] = errX(errX.rows() / 2);
-    Eigen::ArrayXd errY{diff.y().abs()};
+    Eigen::ArrayXd errY{diff.derived().y().abs()};
     std::sort(errY.begin(), errY.end());
     state.counters["ErrMaxY"] = errY(errY.rows() - 1);
     state.counters["ErrMedY"] = errY(errY.rows() / 2);
   }
 
   void posCartes(benchmark::State &state) {
+    posCartes(state, m_circleTransform);
+  }
+
+  template <typename TransformType>
+  void posCartes(benchmark::State &state, const TransformType &transform) {
     Points<numQueries> posCartes{};
     for (auto _ : state)
-      posCartes = m_circleTransform.posCartes(m_posFrenet);
+      posCartes = transform.posCartes(m_posFrenet);
     reportError(posCartes - m_posCartes, state);
   }
 
+  void posFrenetJacobians(benchmark::State &state) {
+    Points<numQueries> posFrenet{};
+    Jacobians<numQueries> jacobians{};
+    for (auto _ : state)
+      posFrenet = m_circleTransform.posFrenet(m_posCartes, jacobians);
+    reportError(posFrenet - m_posFrenet, state);
+  }
+
+  void posFrenetFloat(benchmark::State &state) {
+    PointsFloat posFrenet{};
+    for (auto _ : state)
+      posFrenet = m_circleTransformFloat.posFrenet(m_posCartesFloat);
+    reportError(toDouble(posFrenet) - m_posFrenet, state);
+  }
+
   void velCartes(benchmark::State &state) {
     Points<numQueries> velCartes{};
     for (auto _ : state)
@@ -115,10 +200,64 @@ protected:
     reportError(accCartes - m_accCartes, state);
   }
 
+  void accCartesBatches(benchmark::State &state) {
+    // hypotheses at the same positions transformed one after another
+    Points<numQueries> accCartes{};
+    TransformWorkspace<numQueries> workspace{m_posFrenet.numPoints()};
+    accCartes.resize(m_posFrenet.numPoints());
+    for (auto _ : state)
+      for (int batch{}; batch < s_numBatches; ++batch)
+        m_circleTransform.accCartes(m_accFrenet, m_velFrenet, m_posFrenet,
+                                    accCartes, workspace);
+    reportError(accCartes - m_accCartes, state);
+  }
+
+  void accCartesFrameSet(benchmark::State &state) {
+    // hypotheses at the same positions sharing frames bound once
+    Points<numQueries> accCartes{};
+    accCartes.resize(m_posFrenet.numPoints());
+    for (auto _ : state) {
+      const auto frameSet{m_circleTransform.frameSet(m_posFrenet)};
+      for (int batch{}; batch < s_numBatches; ++batch)
+        frameSet.accCartes(m_accFrenet, m_velFrenet, accCartes);
+    }
+    reportError(accCartes - m_accCartes, state);
+  }
+
   void posFrenet(benchmark::State &state) {
+    posFrenet(state, m_circleTransform);
+  }
+
+  template <typename TransformType>
+  void posFrenet(benchmark::State &state, const TransformType &transform) {
     Points<numQueries> posFrenet{};
     for (auto _ : state)
-      posFrenet = m_circleTransform.posFrenet(m_posCartes);
+      posFrenet = transform.posFrenet(m_posCartes);
+    reportError(posFrenet - m_posFrenet, state);
+  }
+
+  void posFrenet(benchmark::State &state, Search search) {
+    m_circlePoly.setSearch(search);
+    m_circleTransform = Transform<numQueries>{
+        std::make_shared<Polychain<numPoints, numQueries>>(m_circlePoly)};
+    posFrenet(state);
+  }
+
+  void posFrenetRaster(benchmark::State &state) {
+    // raster covers all query points
+    const double extent{2 * m_circle.radius()};
+    m_circlePoly.setRaster({-extent, -extent}, {extent, extent},
+                           s_rasterResolution);
+    m_circleTransform = Transform<numQueries>{
+        std::make_shared<Polychain<numPoints, numQueries>>(m_circlePoly)};
+    posFrenet(state);
+  }
+
+  void posFrenetHint(benchmark::State &state) {
+    Points<numQueries> posFrenet{};
+    for (auto _ : state)
+      posFrenet = m_circleTransform.posFrenet(m_posCartes, m_posFrenet.x(),
+                                              s_hintWindow);
     reportError(posFrenet - m_posFrenet, state);
   }
 
@@ -129,6 +268,15 @@ protected:
     reportError(velFrenet - m_velFrenet, state);
   }
 
+  void velFrenetJacobians(benchmark::State &state) {
+    Points<numQueries> velFrenet{};
+    Jacobians<numQueries> jacobians{};
+    for (auto _ : state)
+      velFrenet =
+          m_circleTransform.velFrenet(m_velCartes, m_posFrenet, jacobians);
+    reportError(velFrenet - m_velFrenet, state);
+  }
+
   void accFrenet(benchmark::State &state) {
     Points<numQueries> accFrenet{};
     for (auto _ : state)
@@ -136,6 +284,55 @@ protected:
           m_circleTransform.accFrenet(m_accCartes, m_velFrenet, m_posFrenet);
     reportError(accFrenet - m_accFrenet, state);
   }
+
+  void stateFrenet(benchmark::State &state) {
+    stateFrenet(state, m_circleTransform);
+  }
+
+  template <typename TransformType>
+  void stateFrenet(benchmark::State &state, const TransformType &transform) {
+    States<numQueries> states{};
+    for (auto _ : state)
+      states = transform.stateFrenet(m_posCartes, m_velCartes, m_accCartes);
+    reportError(states.acc - m_accFrenet, state);
+  }
+
+  void stateFrenetFloat(benchmark::State &state) {
+    States<numQueries, float> states{};
+    for (auto _ : state)
+      states = m_circleTransformFloat.stateFrenet(
+          m_posCartesFloat, m_velCartesFloat, m_accCartesFloat);
+    reportError(toDouble(states.acc) - m_accFrenet, state);
+  }
+
+  void stateFrenetWorkspace(benchmark::State &state) {
+    States<numQueries> states{};
+    TransformWorkspace<numQueries> workspace{m_posCartes.numPoints()};
+    for (auto _ : state)
+      m_circleTransform.stateFrenet(m_posCartes, m_velCartes, m_accCartes,
+                                    states, workspace);
+    reportError(states.acc - m_accFrenet, state);
+  }
+
+  void stateCartes(benchmark::State &state) {
+    stateCartes(state, m_circleTransform);
+  }
+
+  template <typename TransformType>
+  void stateCartes(benchmark::State &state, const TransformType &transform) {
+    States<numQueries> states{};
+    for (auto _ : state)
+      states = transform.stateCartes(m_posFrenet, m_velFrenet, m_accFrenet);
+    reportError(states.acc - m_accCartes, state);
+  }
+
+  void stateCartesFloat(benchmark::State &state) {
+    States<numQueries, float> states{};
+    for (auto _ : state)
+      states = m_circleTransformFloat.stateCartes(
+          m_posFrenetFloat, m_velFrenetFloat, m_accFrenetFloat);
+    reportError(toDouble(states.acc) - m_accCartes, state);
+  }
 };
 
 using Dynamic =
@@ -177,6 +374,24 @@ BENCHMARK_REGISTER_F(PolylineBenchmark, PosCartesStatic4096)
     ->Args({4096, 4096})
     ->ArgNames({"NumQueries", "NumPoints"});
 
+BENCHMARK_TEMPLATE_DEFINE_F(PolylineBenchmark, PosCartesStaticDispatchDyn,
+                            Dynamic)
+(benchmark::State &state) {
+  posCartes(state, m_circleTransformStatic);
+}
+BENCHMARK_REGISTER_F(PolylineBenchmark, PosCartesStaticDispatchDyn)
+    ->Ranges({{8, 8 << 10}, {8, 8 << 10}})
+    ->ArgNames({"NumQueries", "NumPoints"});
+
+BENCHMARK_TEMPLATE_DEFINE_F(PolylineBenchmark, PosCartesStaticDispatch8,
+                            Static8)
+(benchmark::State &state) {
+  posCartes(state, m_circleTransformStatic);
+}
+BENCHMARK_REGISTER_F(PolylineBenchmark, PosCartesStaticDispatch8)
+    ->Args({8, 8})
+    ->ArgNames({"NumQueries", "NumPoints"});
+
 // Benchmark: velCartes
 BENCHMARK_TEMPLATE_DEFINE_F(PolylineBenchmark, VelCartesDynamic, Dynamic)
 (benchmark::State &state) {
@@ -195,6 +410,22 @@ BENCHMARK_REGISTER_F(PolylineBenchmark, AccCartesDynamic)
     ->Ranges({{8, 8 << 10}, {8, 8 << 10}})
     ->ArgNames({"NumQueries", "NumPoints"});
 
+BENCHMARK_TEMPLATE_DEFINE_F(PolylineBenchmark, AccCartesBatchesDyn, Dynamic)
+(benchmark::State &state) {
+  accCartesBatches(state);
+}
+BENCHMARK_REGISTER_F(PolylineBenchmark, AccCartesBatchesDyn)
+    ->Ranges({{8, 8 << 10}, {8, 8 << 10}})
+    ->ArgNames({"NumQueries", "NumPoints"});
+
+BENCHMARK_TEMPLATE_DEFINE_F(PolylineBenchmark, AccCartesFrameSetDyn, Dynamic)
+(benchmark::State &state) {
+  accCartesFrameSet(state);
+}
+BENCHMARK_REGISTER_F(PolylineBenchmark, AccCartesFrameSetDyn)
+    ->Ranges({{8, 8 << 10}, {8, 8 << 10}})
+    ->ArgNames({"NumQueries", "NumPoints"});
+
 // Benchmark: posFrenet
 BENCHMARK_TEMPLATE_DEFINE_F(PolylineBenchmark, PosFrenetDyn, Dynamic)
 (benchmark::State &state) {
@@ -228,6 +459,94 @@ BENCHMARK_REGISTER_F(PolylineBenchmark, PosFrenetStatic4096)
     ->Args({4096, 4096})
     ->ArgNames({"NumQueries", "NumPoints"});
 
+BENCHMARK_TEMPLATE_DEFINE_F(PolylineBenchmark, PosFrenetAutoDyn, Dynamic)
+(benchmark::State &state) {
+  posFrenet(state, Search::Auto);
+}
+BENCHMARK_REGISTER_F(PolylineBenchmark, PosFrenetAutoDyn)
+    ->Ranges({{8, 8 << 10}, {8, 8 << 10}})
+    ->ArgNames({"NumQueries", "NumPoints"});
+
+BENCHMARK_TEMPLATE_DEFINE_F(PolylineBenchmark, PosFrenetTreeDyn, Dynamic)
+(benchmark::State &state) {
+  posFrenet(state, Search::Tree);
+}
+BENCHMARK_REGISTER_F(PolylineBenchmark, PosFrenetTreeDyn)
+    ->Ranges({{8, 8 << 10}, {8, 8 << 10}})
+    ->ArgNames({"NumQueries", "NumPoints"});
+
+BENCHMARK_TEMPLATE_DEFINE_F(PolylineBenchmark, PosFrenetGridDyn, Dynamic)
+(benchmark::State &state) {
+  posFrenet(state, Search::Grid);
+}
+BENCHMARK_REGISTER_F(PolylineBenchmark, PosFrenetGridDyn)
+    ->Ranges({{8, 8 << 10}, {8, 8 << 10}})
+    ->ArgNames({"NumQueries", "NumPoints"});
+
+BENCHMARK_TEMPLATE_DEFINE_F(PolylineBenchmark, PosFrenetCoarseDyn, Dynamic)
+(benchmark::State &state) {
+  posFrenet(state, Search::Coarse);
+}
+BENCHMARK_REGISTER_F(PolylineBenchmark, PosFrenetCoarseDyn)
+    ->Ranges({{8, 8 << 10}, {8, 128 << 10}})
+    ->ArgNames({"NumQueries", "NumPoints"});
+
+BENCHMARK_TEMPLATE_DEFINE_F(PolylineBenchmark, PosFrenetRasterDyn, Dynamic)
+(benchmark::State &state) {
+  posFrenetRaster(state);
+}
+BENCHMARK_REGISTER_F(PolylineBenchmark, PosFrenetRasterDyn)
+    ->Ranges({{8, 8 << 10}, {8, 8 << 10}})
+    ->ArgNames({"NumQueries", "NumPoints"});
+
+BENCHMARK_TEMPLATE_DEFINE_F(PolylineBenchmark, PosFrenetHintDyn, Dynamic)
+(benchmark::State &state) {
+  posFrenetHint(state);
+}
+BENCHMARK_REGISTER_F(PolylineBenchmark, PosFrenetHintDyn)
+    ->Ranges({{8, 8 << 10}, {8, 8 << 10}})
+    ->ArgNames({"NumQueries", "NumPoints"});
+
+BENCHMARK_TEMPLATE_DEFINE_F(PolylineBenchmark, PosFrenetSplineDyn, Dynamic)
+(benchmark::State &state) {
+  posFrenet(state, m_circleTransformSpline);
+}
+BENCHMARK_REGISTER_F(PolylineBenchmark, PosFrenetSplineDyn)
+    ->Ranges({{8, 8 << 10}, {8, 512}})
+    ->ArgNames({"NumQueries", "NumPoints"});
+
+BENCHMARK_TEMPLATE_DEFINE_F(PolylineBenchmark, PosFrenetClothoidDyn, Dynamic)
+(benchmark::State &state) {
+  posFrenet(state, m_circleTransformClothoid);
+}
+BENCHMARK_REGISTER_F(PolylineBenchmark, PosFrenetClothoidDyn)
+    ->Ranges({{8, 8 << 10}, {8, 512}})
+    ->ArgNames({"NumQueries", "NumPoints"});
+
+BENCHMARK_TEMPLATE_DEFINE_F(PolylineBenchmark, PosFrenetArcsDyn, Dynamic)
+(benchmark::State &state) {
+  posFrenet(state, m_circleTransformArcs);
+}
+BENCHMARK_REGISTER_F(PolylineBenchmark, PosFrenetArcsDyn)
+    ->Ranges({{8, 8 << 10}, {8, 512}})
+    ->ArgNames({"NumQueries", "NumPoints"});
+
+BENCHMARK_TEMPLATE_DEFINE_F(PolylineBenchmark, PosFrenetFloatDyn, Dynamic)
+(benchmark::State &state) {
+  posFrenetFloat(state);
+}
+BENCHMARK_REGISTER_F(PolylineBenchmark, PosFrenetFloatDyn)
+    ->Ranges({{8, 8 << 10}, {8, 8 << 10}})
+    ->ArgNames({"NumQueries", "NumPoints"});
+
+BENCHMARK_TEMPLATE_DEFINE_F(PolylineBenchmark, PosFrenetJacobiansDyn, Dynamic)
+(benchmark::State &state) {
+  posFrenetJacobians(state);
+}
+BENCHMARK_REGISTER_F(PolylineBenchmark, PosFrenetJacobiansDyn)
+    ->Ranges({{8, 8 << 10}, {8, 8 << 10}})
+    ->ArgNames({"NumQueries", "NumPoints"});
+
 // Benchmark: velFrenet
 BENCHMARK_TEMPLATE_DEFINE_F(PolylineBenchmark, VelFrenetDyn, Dynamic)
 (benchmark::State &state) {
@@ -237,6 +556,14 @@ BENCHMARK_REGISTER_F(PolylineBenchmark, VelFrenetDyn)
     ->Ranges({{8, 8 << 10}, {8, 8 << 10}})
     ->ArgNames({"NumQueries", "NumPoints"});
 
+BENCHMARK_TEMPLATE_DEFINE_F(PolylineBenchmark, VelFrenetJacobiansDyn, Dynamic)
+(benchmark::State &state) {
+  velFrenetJacobians(state);
+}
+BENCHMARK_REGISTER_F(PolylineBenchmark, VelFrenetJacobiansDyn)
+    ->Ranges({{8, 8 << 10}, {8, 8 << 10}})
+    ->ArgNames({"NumQueries", "NumPoints"});
+
 // Benchmark: accFrenet
 BENCHMARK_TEMPLATE_DEFINE_F(PolylineBenchmark, AccFrenetDyn, Dynamic)
 (benchmark::State &state) {
@@ -245,6 +572,115 @@ BENCHMARK_TEMPLATE_DEFINE_F(PolylineBenchmark, AccFrenetDyn, Dynamic)
 BENCHMARK_REGISTER_F(PolylineBenchmark, AccFrenetDyn)
     ->Ranges({{8, 8 << 10}, {8, 8 << 10}})
     ->ArgNames({"NumQueries", "NumPoints"});
+
+// Benchmark: stateCartes
+BENCHMARK_TEMPLATE_DEFINE_F(PolylineBenchmark, StateCartesDyn, Dynamic)
+(benchmark::State &state) {
+  stateCartes(state);
+}
+BENCHMARK_REGISTER_F(PolylineBenchmark, StateCartesDyn)
+    ->Ranges({{8, 8 << 10}, {8, 8 << 10}})
+    ->ArgNames({"NumQueries", "NumPoints"});
+
+BENCHMARK_TEMPLATE_DEFINE_F(PolylineBenchmark, StateCartesStaticDispatchDyn,
+                            Dynamic)
+(benchmark::State &state) {
+  stateCartes(state, m_circleTransformStatic);
+}
+BENCHMARK_REGISTER_F(PolylineBenchmark, StateCartesStaticDispatchDyn)
+    ->Ranges({{8, 8 << 10}, {8, 8 << 10}})
+    ->ArgNames({"NumQueries", "NumPoints"});
+
+BENCHMARK_TEMPLATE_DEFINE_F(PolylineBenchmark, StateCartesSplineDyn, Dynamic)
+(benchmark::State &state) {
+  stateCartes(state, m_circleTransformSpline);
+}
+BENCHMARK_REGISTER_F(PolylineBenchmark, StateCartesSplineDyn)
+    ->Ranges({{8, 8 << 10}, {8, 512}})
+    ->ArgNames({"NumQueries", "NumPoints"});
+
+BENCHMARK_TEMPLATE_DEFINE_F(PolylineBenchmark, StateCartesClothoidDyn, Dynamic)
+(benchmark::State &state) {
+  stateCartes(state, m_circleTransformClothoid);
+}
+BENCHMARK_REGISTER_F(PolylineBenchmark, StateCartesClothoidDyn)
+    ->Ranges({{8, 8 << 10}, {8, 512}})
+    ->ArgNames({"NumQueries", "NumPoints"});
+
+BENCHMARK_TEMPLATE_DEFINE_F(PolylineBenchmark, StateCartesArcsDyn, Dynamic)
+(benchmark::State &state) {
+  stateCartes(state, m_circleTransformArcs);
+}
+BENCHMARK_REGISTER_F(PolylineBenchmark, StateCartesArcsDyn)
+    ->Ranges({{8, 8 << 10}, {8, 512}})
+    ->ArgNames({"NumQueries", "NumPoints"});
+
+BENCHMARK_TEMPLATE_DEFINE_F(PolylineBenchmark, StateCartesFloatDyn, Dynamic)
+(benchmark::State &state) {
+  stateCartesFloat(state);
+}
+BENCHMARK_REGISTER_F(PolylineBenchmark, StateCartesFloatDyn)
+    ->Ranges({{8, 8 << 10}, {8, 8 << 10}})
+    ->ArgNames({"NumQueries", "NumPoints"});
+
+// Benchmark: stateFrenet
+BENCHMARK_TEMPLATE_DEFINE_F(PolylineBenchmark, StateFrenetDyn, Dynamic)
+(benchmark::State &state) {
+  stateFrenet(state);
+}
+BENCHMARK_REGISTER_F(PolylineBenchmark, StateFrenetDyn)
+    ->Ranges({{8, 8 << 10}, {8, 8 << 10}})
+    ->ArgNames({"NumQueries", "NumPoints"});
+
+BENCHMARK_TEMPLATE_DEFINE_F(PolylineBenchmark, StateFrenetStaticDispatchDyn,
+                            Dynamic)
+(benchmark::State &state) {
+  stateFrenet(state, m_circleTransformStatic);
+}
+BENCHMARK_REGISTER_F(PolylineBenchmark, StateFrenetStaticDispatchDyn)
+    ->Ranges({{8, 8 << 10}, {8, 8 << 10}})
+    ->ArgNames({"NumQueries", "NumPoints"});
+
+BENCHMARK_TEMPLATE_DEFINE_F(PolylineBenchmark, StateFrenetSplineDyn, Dynamic)
+(benchmark::State &state) {
+  stateFrenet(state, m_circleTransformSpline);
+}
+BENCHMARK_REGISTER_F(PolylineBenchmark, StateFrenetSplineDyn)
+    ->Ranges({{8, 8 << 10}, {8, 512}})
+    ->ArgNames({"NumQueries", "NumPoints"});
+
+BENCHMARK_TEMPLATE_DEFINE_F(PolylineBenchmark, StateFrenetClothoidDyn, Dynamic)
+(benchmark::State &state) {
+  stateFrenet(state, m_circleTransformClothoid);
+}
+BENCHMARK_REGISTER_F(PolylineBenchmark, StateFrenetClothoidDyn)
+    ->Ranges({{8, 8 << 10}, {8, 512}})
+    ->ArgNames({"NumQueries", "NumPoints"});
+
+BENCHMARK_TEMPLATE_DEFINE_F(PolylineBenchmark, StateFrenetArcsDyn, Dynamic)
+(benchmark::State &state) {
+  stateFrenet(state, m_circleTransformArcs);
+}
+BENCHMARK_REGISTER_F(PolylineBenchmark, StateFrenetArcsDyn)
+    ->Ranges({{8, 8 << 10}, {8, 512}})
+    ->ArgNames({"NumQueries", "NumPoints"});
+
+BENCHMARK_TEMPLATE_DEFINE_F(PolylineBenchmark, StateFrenetFloatDyn, Dynamic)
+(benchmark::State &state) {
+  stateFrenetFloat(state);
+}
+BENCHMARK_REGISTER_F(PolylineBenchmark, StateFrenetFloatDyn)
+    ->Ranges({{8, 8 << 10}, {8, 8 << 10}})
+    ->ArgNames({"NumQueries", "NumPoints"});
+
+BENCHMARK_TEMPLATE_DEFINE_F(PolylineBenchmark, StateFrenetWorkspaceDyn,
+                            Dynamic)
+(benchmark::State &state) {
+  stateFrenetWorkspace(state);
+}
+BENCHMARK_REGISTER_F(PolylineBenchmark, StateFrenetWorkspaceDyn)
+    ->Ranges({{8, 8 << 10}, {8, 8 << 10}})
+    ->ArgNames({"NumQueries", "NumPoints"});
 }; // namespace Internal
 }; // namespace FrenetTransform
 
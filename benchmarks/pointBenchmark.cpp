@@ -0,0 +1,227 @@
+#include <benchmark/benchmark.h>
+
+#include "frenetTransform/internal/circle.h"
+#include "frenetTransform/point.h"
+#include "frenetTransform/points.h"
+#include "frenetTransform/polychain.h"
+#include "frenetTransform/transform.h"
+
+namespace FrenetTransform {
+namespace Internal {
+/**
+ * @brief Latency of transforming single objects, one query point per call.
+ * Compares the Point overloads with single query points wrapped into Points.
+ *
+ */
+class PointBenchmark : public benchmark::Fixture {
+protected:
+  using PointsDyn = Points<Eigen::Dynamic>;
+  using PolychainDyn = Polychain<Eigen::Dynamic>;
+
+  const Circle<Eigen::Dynamic> m_circleApprox{5.0, {0.0, 0.0}, -M_PI};
+
+  // query states cycled through one per call
+  PointsDyn m_posFrenet{};
+  PointsDyn m_velFrenet{};
+  PointsDyn m_accFrenet{};
+  PointsDyn m_posCartes{};
+  PointsDyn m_velCartes{};
+  PointsDyn m_accCartes{};
+
+  static constexpr int s_numQueries{256};
+  static constexpr double s_hintWindow{0.1};
+
+  Transform<> m_transform{};
+  // path bound at compile time
+  Transform<Eigen::Dynamic, PolychainDyn> m_transformStatic{};
+  // single query point arrays of fixed size
+  Transform<1> m_transform1{};
+
+  void SetUp(::benchmark::State &state) {
+    const double radius{m_circleApprox.radius()};
+    std::srand(0);
+    m_posFrenet = {(Eigen::ArrayXd::Random(s_numQueries) + 1) * M_PI / 2 *
+                       radius,
+                   Eigen::ArrayXd::Random(s_numQueries) * radius / 2};
+    m_velFrenet = {Eigen::ArrayXd::Random(s_numQueries) * radius,
+                   Eigen::ArrayXd::Random(s_numQueries)};
+    m_accFrenet = {Eigen::ArrayXd::Random(s_numQueries) * radius,
+                   Eigen::ArrayXd::Random(s_numQueries)};
+
+    const PolychainDyn polychain{m_circleApprox(
+        Eigen::ArrayXd::LinSpaced(state.range(0), 0.0, 3 * M_PI / 2) *
+        radius)};
+    m_transform = Transform<>{std::make_shared<PolychainDyn>(polychain)};
+    m_transformStatic = Transform<Eigen::Dynamic, PolychainDyn>{
+        std::make_shared<PolychainDyn>(polychain)};
+    m_transform1 = Transform<1>{std::make_shared<Polychain<Eigen::Dynamic, 1>>(
+        m_circleApprox(
+            Eigen::ArrayXd::LinSpaced(state.range(0), 0.0, 3 * M_PI / 2) *
+            radius))};
+
+    const States<> states{
+        m_transform.stateCartes(m_posFrenet, m_velFrenet, m_accFrenet)};
+    m_posCartes = states.pos;
+    m_velCartes = states.vel;
+    m_accCartes = states.acc;
+  }
+
+  /**
+   * @brief Wrap a single query point into Points.
+   *
+   * @tparam NumQueries number of query points, 1 or -1 for dynamic.
+   * @param point query point.
+   * @return Points<NumQueries> with the single query point.
+   */
+  template <int NumQueries>
+  static Points<NumQueries> wrap(const Point &point) {
+    return {Eigen::Array<double, NumQueries, 1>::Constant(1, point.x()),
+            Eigen::Array<double, NumQueries, 1>::Constant(1, point.y())};
+  }
+
+  template <typename TransformType>
+  void posFrenetPoint(benchmark::State &state,
+                      const TransformType &transform) {
+    int index{};
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(transform.posFrenet(m_posCartes(index)));
+      index = (index + 1) % s_numQueries;
+    }
+  }
+
+  void posFrenetPointHint(benchmark::State &state) {
+    int index{};
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(m_transformStatic.posFrenet(
+          m_posCartes(index), m_posFrenet.x(index), s_hintWindow));
+      index = (index + 1) % s_numQueries;
+    }
+  }
+
+  template <int NumQueries, typename TransformType>
+  void posFrenetPoints(benchmark::State &state,
+                       const TransformType &transform) {
+    int index{};
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(
+          transform.posFrenet(wrap<NumQueries>(m_posCartes(index))));
+      index = (index + 1) % s_numQueries;
+    }
+  }
+
+  template <typename TransformType>
+  void stateFrenetPoint(benchmark::State &state,
+                        const TransformType &transform) {
+    int index{};
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(transform.stateFrenet(
+          m_posCartes(index), m_velCartes(index), m_accCartes(index)));
+      index = (index + 1) % s_numQueries;
+    }
+  }
+
+  template <int NumQueries, typename TransformType>
+  void stateFrenetPoints(benchmark::State &state,
+                         const TransformType &transform) {
+    int index{};
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(
+          transform.stateFrenet(wrap<NumQueries>(m_posCartes(index)),
+                                wrap<NumQueries>(m_velCartes(index)),
+                                wrap<NumQueries>(m_accCartes(index))));
+      index = (index + 1) % s_numQueries;
+    }
+  }
+
+  template <typename TransformType>
+  void stateCartesPoint(benchmark::State &state,
+                        const TransformType &transform) {
+    int index{};
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(transform.stateCartes(
+          m_posFrenet(index), m_velFrenet(index), m_accFrenet(index)));
+      index = (index + 1) % s_numQueries;
+    }
+  }
+
+  template <int NumQueries, typename TransformType>
+  void stateCartesPoints(benchmark::State &state,
+                         const TransformType &transform) {
+    int index{};
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(
+          transform.stateCartes(wrap<NumQueries>(m_posFrenet(index)),
+                                wrap<NumQueries>(m_velFrenet(index)),
+                                wrap<NumQueries>(m_accFrenet(index))));
+      index = (index + 1) % s_numQueries;
+    }
+  }
+};
+
+// Benchmark: posFrenet
+BENCHMARK_DEFINE_F(PointBenchmark, PosFrenetPoint)(benchmark::State &state) {
+  posFrenetPoint(state, m_transform);
+}
+BENCHMARK_REGISTER_F(PointBenchmark, PosFrenetPoint)
+    ->Range(8, 8 << 10)
+    ->ArgNames({"NumPoints"});
+
+BENCHMARK_DEFINE_F(PointBenchmark, PosFrenetPointStatic)
+(benchmark::State &state) { posFrenetPoint(state, m_transformStatic); }
+BENCHMARK_REGISTER_F(PointBenchmark, PosFrenetPointStatic)
+    ->Range(8, 8 << 10)
+    ->ArgNames({"NumPoints"});
+
+BENCHMARK_DEFINE_F(PointBenchmark, PosFrenetPointHint)
+(benchmark::State &state) { posFrenetPointHint(state); }
+BENCHMARK_REGISTER_F(PointBenchmark, PosFrenetPointHint)
+    ->Range(8, 8 << 10)
+    ->ArgNames({"NumPoints"});
+
+BENCHMARK_DEFINE_F(PointBenchmark, PosFrenetPointsDyn)
+(benchmark::State &state) {
+  posFrenetPoints<Eigen::Dynamic>(state, m_transform);
+}
+BENCHMARK_REGISTER_F(PointBenchmark, PosFrenetPointsDyn)
+    ->Range(8, 8 << 10)
+    ->ArgNames({"NumPoints"});
+
+BENCHMARK_DEFINE_F(PointBenchmark, PosFrenetPoints1)
+(benchmark::State &state) { posFrenetPoints<1>(state, m_transform1); }
+BENCHMARK_REGISTER_F(PointBenchmark, PosFrenetPoints1)
+    ->Range(8, 8 << 10)
+    ->ArgNames({"NumPoints"});
+
+// Benchmark: stateFrenet
+BENCHMARK_DEFINE_F(PointBenchmark, StateFrenetPoint)
+(benchmark::State &state) { stateFrenetPoint(state, m_transform); }
+BENCHMARK_REGISTER_F(PointBenchmark, StateFrenetPoint)
+    ->Range(8, 8 << 10)
+    ->ArgNames({"NumPoints"});
+
+BENCHMARK_DEFINE_F(PointBenchmark, StateFrenetPointsDyn)
+(benchmark::State &state) {
+  stateFrenetPoints<Eigen::Dynamic>(state, m_transform);
+}
+BENCHMARK_REGISTER_F(PointBenchmark, StateFrenetPointsDyn)
+    ->Range(8, 8 << 10)
+    ->ArgNames({"NumPoints"});
+
+// Benchmark: stateCartes
+BENCHMARK_DEFINE_F(PointBenchmark, StateCartesPoint)
+(benchmark::State &state) { stateCartesPoint(state, m_transform); }
+BENCHMARK_REGISTER_F(PointBenchmark, StateCartesPoint)
+    ->Range(8, 8 << 10)
+    ->ArgNames({"NumPoints"});
+
+BENCHMARK_DEFINE_F(PointBenchmark, StateCartesPointsDyn)
+(benchmark::State &state) {
+  stateCartesPoints<Eigen::Dynamic>(state, m_transform);
+}
+BENCHMARK_REGISTER_F(PointBenchmark, StateCartesPointsDyn)
+    ->Range(8, 8 << 10)
+    ->ArgNames({"NumPoints"});
+}; // namespace Internal
+}; // namespace FrenetTransform
+
+BENCHMARK_MAIN();
@@ -0,0 +1,80 @@
+#include <benchmark/benchmark.h>
+
+#include "frenetTransform/arcChain.h"
+#include "frenetTransform/points.h"
+#include "frenetTransform/polychain.h"
+#include "frenetTransform/resample.h"
+#include "frenetTransform/transform.h"
+
+namespace FrenetTransform {
+namespace Internal {
+/**
+ * @brief Errors of polychains through points of a track with uniform spacing
+ * and with spacing resampled by curvature for the same number of points.
+ *
+ */
+class ResampleBenchmark : public benchmark::Fixture {
+protected:
+  using PointsDyn = Points<Eigen::Dynamic>;
+  using PolychainDyn = Polychain<Eigen::Dynamic>;
+
+  // straight, quarter circle of radius 20 and straight
+  static constexpr double s_trackLength{100.0 + 10 * M_PI};
+  const ArcChain<> m_track{
+      Point{0.0, 0.0}, 0.0,
+      Eigen::Array4d{0.0, 50.0, 50.0 + 10 * M_PI, s_trackLength},
+      Eigen::Array3d{0.0, 0.05, 0.0}};
+
+  static constexpr int s_numQueries{512};
+
+  PointsDyn m_posFrenet{};
+  PointsDyn m_posCartes{};
+  Transform<Eigen::Dynamic, PolychainDyn> m_transform{};
+
+  void SetUp(::benchmark::State &state) {
+    std::srand(0);
+    // lateral offsets within half the radius of the arc
+    m_posFrenet = {(Eigen::ArrayXd::Random(s_numQueries) + 1) / 2 *
+                       s_trackLength,
+                   Eigen::ArrayXd::Random(s_numQueries) * 10.0};
+    const Transform<> exact{std::make_shared<ArcChain<>>(m_track)};
+    m_posCartes = exact.posCartes(m_posFrenet);
+
+    const int numPoints{static_cast<int>(state.range(0))};
+    const Eigen::ArrayXd lengths{
+        state.range(1) ? resample(m_track, 0.0, s_trackLength, numPoints)
+                       : Eigen::ArrayXd{Eigen::ArrayXd::LinSpaced(
+                             numPoints, 0.0, s_trackLength)}};
+    m_transform = Transform<Eigen::Dynamic, PolychainDyn>{
+        std::make_shared<PolychainDyn>(m_track(lengths))};
+  }
+
+  static void reportError(const PointsDyn &diff, benchmark::State &state) {
+    state.counters["ErrMaxX"] = diff.x().abs().maxCoeff();
+    state.counters["ErrMaxY"] = diff.y().abs().maxCoeff();
+  }
+};
+
+BENCHMARK_DEFINE_F(ResampleBenchmark, PosFrenet)(benchmark::State &state) {
+  PointsDyn posFrenet{};
+  for (auto _ : state)
+    posFrenet = m_transform.posFrenet(m_posCartes);
+  reportError(posFrenet - m_posFrenet, state);
+}
+BENCHMARK_REGISTER_F(ResampleBenchmark, PosFrenet)
+    ->ArgsProduct({{16, 64, 256, 1024}, {0, 1}})
+    ->ArgNames({"NumPoints", "Resampled"});
+
+BENCHMARK_DEFINE_F(ResampleBenchmark, PosCartes)(benchmark::State &state) {
+  PointsDyn posCartes{};
+  for (auto _ : state)
+    posCartes = m_transform.posCartes(m_posFrenet);
+  reportError(posCartes - m_posCartes, state);
+}
+BENCHMARK_REGISTER_F(ResampleBenchmark, PosCartes)
+    ->ArgsProduct({{16, 64, 256, 1024}, {0, 1}})
+    ->ArgNames({"NumPoints", "Resampled"});
+}; // namespace Internal
+}; // namespace FrenetTransform
+
+BENCHMARK_MAIN();
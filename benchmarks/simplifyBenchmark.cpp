@@ -0,0 +1,85 @@
+#include <benchmark/benchmark.h>
+
+#include "frenetTransform/arcChain.h"
+#include "frenetTransform/points.h"
+#include "frenetTransform/polychain.h"
+#include "frenetTransform/simplify.h"
+#include "frenetTransform/transform.h"
+
+namespace FrenetTransform {
+namespace Internal {
+/**
+ * @brief Projection onto a densely sampled track after simplifications with
+ * increasing deviations. A negative deviation keeps all points and a deviation
+ * of zero removes only the points inside the straights.
+ *
+ */
+class SimplifyBenchmark : public benchmark::Fixture {
+protected:
+  using PointsDyn = Points<Eigen::Dynamic>;
+  using PolychainDyn = Polychain<Eigen::Dynamic>;
+
+  // straight, quarter circle of radius 20 and straight
+  static constexpr double s_trackLength{100.0 + 10 * M_PI};
+  const ArcChain<> m_track{
+      Point{0.0, 0.0}, 0.0,
+      Eigen::Array4d{0.0, 50.0, 50.0 + 10 * M_PI, s_trackLength},
+      Eigen::Array3d{0.0, 0.05, 0.0}};
+
+  static constexpr int s_numQueries{512};
+  static constexpr double s_spacing{0.1};
+
+  PointsDyn m_posFrenet{};
+  PointsDyn m_posCartes{};
+  Simplified m_simplified{};
+  Transform<Eigen::Dynamic, PolychainDyn> m_transform{};
+
+  void SetUp(::benchmark::State &state) {
+    std::srand(0);
+    // lateral offsets within half the radius of the arc
+    m_posFrenet = {(Eigen::ArrayXd::Random(s_numQueries) + 1) / 2 *
+                       s_trackLength,
+                   Eigen::ArrayXd::Random(s_numQueries) * 10.0};
+    const Transform<> exact{std::make_shared<ArcChain<>>(m_track)};
+    m_posCartes = exact.posCartes(m_posFrenet);
+
+    // map export with vertices every 10 cm
+    const PointsDyn points{m_track(Eigen::ArrayXd::LinSpaced(
+        static_cast<int>(s_trackLength / s_spacing) + 1, 0.0,
+        s_trackLength))};
+    if (state.range(0) < 0)
+      m_simplified = {points,
+                      Eigen::ArrayXi::LinSpaced(points.numPoints(), 0,
+                                                points.numPoints() - 1)};
+    else
+      m_simplified = simplify(points.x(), points.y(), state.range(0) * 1e-6);
+    m_transform = Transform<Eigen::Dynamic, PolychainDyn>{
+        std::make_shared<PolychainDyn>(m_simplified.points)};
+  }
+
+};
+
+BENCHMARK_DEFINE_F(SimplifyBenchmark, PosFrenet)(benchmark::State &state) {
+  PointsDyn posFrenet{};
+  for (auto _ : state)
+    posFrenet = m_transform.posFrenet(m_posCartes);
+
+  state.counters["NumPoints"] = m_simplified.points.numPoints();
+  state.counters["Deviation"] = m_simplified.deviation;
+  state.counters["CurvatureError"] = m_simplified.curvatureError;
+  // lengths along the simplified polychain shorten by the removed chords
+  state.counters["ErrMaxX"] =
+      (posFrenet.x() - m_posFrenet.x()).abs().maxCoeff();
+  state.counters["ErrMaxY"] =
+      (posFrenet.y() - m_posFrenet.y()).abs().maxCoeff();
+}
+BENCHMARK_REGISTER_F(SimplifyBenchmark, PosFrenet)
+    ->Arg(-1)
+    ->Arg(0)
+    ->RangeMultiplier(10)
+    ->Range(1, 100000)
+    ->ArgNames({"DeviationMicro"});
+}; // namespace Internal
+}; // namespace FrenetTransform
+
+BENCHMARK_MAIN();
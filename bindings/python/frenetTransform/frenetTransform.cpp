@@ -1,17 +1,41 @@
+#include "frenetTransform/arcChain.h"
+#include "frenetTransform/clothoidSpline.h"
 #include "frenetTransform/point.h"
 #include "frenetTransform/points.h"
 #include "frenetTransform/polychain.h"
+#include "frenetTransform/resample.h"
+#include "frenetTransform/simplify.h"
+#include "frenetTransform/spline.h"
 #include "frenetTransform/transform.h"
 
 #include <pybind11/eigen.h>
+#include <pybind11/numpy.h>
 #include <pybind11/operators.h>
+#include <limits>
 #include <pybind11/pybind11.h>
+#include <tuple>
 
 namespace py = pybind11;
 
 namespace FrenetTransform {
 using namespace pybind11::literals;
 
+/**
+ * @brief Copy batched 2x2 matrices into an array of shape (numMatrices, 2, 2).
+ *
+ * @param matrices batched matrices.
+ * @return py::array_t<double> matrices as numpy array.
+ */
+py::array_t<double> toArray(const Internal::Matrices2<> &matrices) {
+  py::array_t<double> result({matrices.numMatrices(), 2, 2});
+  auto view{result.mutable_unchecked<3>()};
+  for (int index{}; index < matrices.numMatrices(); ++index)
+    for (int row{}; row < 2; ++row)
+      for (int col{}; col < 2; ++col)
+        view(index, row, col) = matrices(row, col)(index);
+  return result;
+}
+
 PYBIND11_MODULE(_core, handle) {
   py::classh<Point>(handle, "Point")
       .def(py::init<>(), R"doc(Construct a default Point at (0, 0).)doc")
@@ -155,14 +179,21 @@ Args:
 Returns:
     np.ndarray: distances to point.
 )doc")
-      .def("__neg__", &PointsD::operator-,
-           R"doc(Negate x- and y-coordinates.
+      .def(
+          "__neg__", [](const PointsD &points) { return PointsD{-points}; },
+          py::is_operator(),
+          R"doc(Negate x- and y-coordinates.
 
 Returns:
     Points: Points with negated x- and y-coordinates.
 )doc")
-      .def(py::self + py::self,
-           R"doc(Element-wise sum of two Points.
+      .def(
+          "__add__",
+          [](const PointsD &points1, const PointsD &points2) {
+            return PointsD{points1 + points2};
+          },
+          py::is_operator(),
+          R"doc(Element-wise sum of two Points.
 
 Returns:
     Points: Points with sum of coordinates of two Points.
@@ -170,7 +201,7 @@ Returns:
       .def(
           "__add__",
           [](const PointsD &points, const Point &point) {
-            return points + point;
+            return PointsD{points + point};
           },
           py::is_operator(),
           R"doc(Element-wise sum of Points and Point.
@@ -184,7 +215,7 @@ Returns:
       .def(
           "__add__",
           [](const Point &point, const PointsD &points) {
-            return points + point;
+            return PointsD{points + point};
           },
           py::is_operator(),
           R"doc(Element-wise sum of Point and Points.
@@ -195,8 +226,13 @@ Args:
 Returns:
     Points: Points with sum of coordinates in point and points.
 )doc")
-      .def(py::self - py::self,
-           R"doc(Element-wise difference between two Points.
+      .def(
+          "__sub__",
+          [](const PointsD &points1, const PointsD &points2) {
+            return PointsD{points1 - points2};
+          },
+          py::is_operator(),
+          R"doc(Element-wise difference between two Points.
 
 Returns:
     Points: Points with difference between coordinates of two Points.
@@ -204,7 +240,7 @@ Returns:
       .def(
           "__sub__",
           [](const PointsD &points, const Point &point) {
-            return points - point;
+            return PointsD{points - point};
           },
           py::is_operator(),
           R"doc(Element-wise difference between Points and Point.
@@ -218,7 +254,7 @@ Returns:
       .def(
           "__sub__",
           [](const Point &point, const PointsD &points) {
-            return point - points;
+            return PointsD{point - points};
           },
           py::is_operator(),
           R"doc(Element-wise difference between Point and Points.
@@ -229,8 +265,13 @@ Args:
 Returns:
     Points: Points with difference between coordinates in point and points.
 )doc")
-      .def(py::self * py::self,
-           R"doc(Element-wise scalar product of two Points.
+      .def(
+          "__mul__",
+          [](const PointsD &points1, const PointsD &points2) {
+            return PointsD::ArrayPoints{points1 * points2};
+          },
+          py::is_operator(),
+          R"doc(Element-wise scalar product of two Points.
 
 Args:
     points (Points): other Points sequence for scalar product.
@@ -240,7 +281,7 @@ Returns:
       .def(
           "__mul__",
           [](const PointsD::ArrayPoints &nums, const PointsD &points) {
-            return nums * points;
+            return PointsD{nums * points};
           },
           py::is_operator(),
           R"doc(Element-wise product of scalars and Points.
@@ -254,7 +295,7 @@ Returns:
       .def(
           "__mul__",
           [](const PointsD &points, const PointsD::ArrayPoints &nums) {
-            return nums * points;
+            return PointsD{nums * points};
           },
           py::is_operator(),
           R"doc(Element-wise product of Points and scalars.
@@ -266,6 +307,112 @@ Returns:
     Points: products of points and nums.
 )doc");
 
+  py::enum_<FrameProperty>(handle, "FrameProperty", py::arithmetic(),
+                           R"doc(Path properties provided by Frames, combined as bit mask.)doc")
+      .value("FramePoints", FramePoints, "points along the path")
+      .value("FrameTangents", FrameTangents, "tangent and normal vectors")
+      .value("FrameCurvatures", FrameCurvatures, "path curvatures")
+      .value("FrameCurvatureRates", FrameCurvatureRates,
+             "path curvature derivatives")
+      .value("FrameAll", FrameAll, "all path properties")
+      .export_values();
+
+  using FramesD = Frames<Eigen::Dynamic>;
+  py::classh<FramesD>(
+      handle, "Frames",
+      R"doc(Frenet frames along a path at query lengths. Properties not requested by the FrameProperty mask remain empty.)doc")
+      .def_readonly("points", &FramesD::points, "points along the path")
+      .def_readonly("tangents", &FramesD::tangents, "tangent vectors")
+      .def_readonly("normals", &FramesD::normals, "normal vectors")
+      .def_readonly("curvatures", &FramesD::curvatures, "path curvatures")
+      .def_readonly("curvatureRates", &FramesD::curvatureRates,
+                    "path curvature derivatives");
+
+  using StatesD = States<Eigen::Dynamic>;
+  py::classh<StatesD>(
+      handle, "States",
+      R"doc(Positions, velocities and accelerations of objects in either Cartesian or Frenet coordinates.)doc")
+      .def_readonly("pos", &StatesD::pos, "positions")
+      .def_readonly("vel", &StatesD::vel, "velocities")
+      .def_readonly("acc", &StatesD::acc, "accelerations");
+
+  using StateD = State<double>;
+  py::classh<StateD>(
+      handle, "State",
+      R"doc(Position, velocity and acceleration of a single object in either Cartesian or Frenet coordinates.)doc")
+      .def_readonly("pos", &StateD::pos, "position")
+      .def_readonly("vel", &StateD::vel, "velocity")
+      .def_readonly("acc", &StateD::acc, "acceleration");
+
+  using FrameSetD = FrameSet<Eigen::Dynamic>;
+  py::classh<FrameSetD>(
+      handle, "FrameSet",
+      R"doc(Frenet frames and transformation matrices bound to fixed Frenet positions. Transforms any number of velocity and acceleration batches at these positions without evaluating the path again.)doc")
+      .def("numQueries", &FrameSetD::numQueries,
+           R"doc(Provide the number of positions the frames are bound to.
+
+Returns:
+    int: number of positions.
+)doc")
+      .def("posFrenet", &FrameSetD::posFrenet,
+           R"doc(Provide the Frenet positions the frames are bound to.
+
+Returns:
+    Points: positions in Frenet coordinates.
+)doc")
+      .def("frames", &FrameSetD::frames,
+           R"doc(Provide the Frenet frames at the positions.
+
+Returns:
+    Frames: tangents, normals, curvatures and curvature derivatives at the positions.
+)doc")
+      .def("velCartes",
+           py::overload_cast<const PointsD &>(&FrameSetD::velCartes,
+                                              py::const_),
+           "velFrenet"_a,
+           R"doc(Transform Frenet velocities at the positions to Cartesian velocities.
+
+Args:
+    velFrenet (Points): query velocities in Frenet coordinates.
+Returns:
+    Points: result velocities in Cartesian coordinates.
+)doc")
+      .def("velFrenet",
+           py::overload_cast<const PointsD &>(&FrameSetD::velFrenet,
+                                              py::const_),
+           "velCartes"_a,
+           R"doc(Transform Cartesian velocities at the positions to Frenet velocities.
+
+Args:
+    velCartes (Points): query velocities in Cartesian coordinates.
+Returns:
+    Points: result velocities in Frenet coordinates.
+)doc")
+      .def("accCartes",
+           py::overload_cast<const PointsD &, const PointsD &>(
+               &FrameSetD::accCartes, py::const_),
+           "accFrenet"_a, "velFrenet"_a,
+           R"doc(Transform Frenet accelerations at the positions to Cartesian accelerations.
+
+Args:
+    accFrenet (Points): query accelerations in Frenet coordinates.
+    velFrenet (Points): velocities corresponding to accelerations in Frenet coordinates.
+Returns:
+    Points: result accelerations in Cartesian coordinates.
+)doc")
+      .def("accFrenet",
+           py::overload_cast<const PointsD &, const PointsD &>(
+               &FrameSetD::accFrenet, py::const_),
+           "accCartes"_a, "velFrenet"_a,
+           R"doc(Transform Cartesian accelerations at the positions to Frenet accelerations.
+
+Args:
+    accCartes (Points): query accelerations in Cartesian coordinates.
+    velFrenet (Points): velocities corresponding to accelerations in Frenet coordinates.
+Returns:
+    Points: result accelerations in Frenet coordinates.
+)doc");
+
   using PathD = Path<Eigen::Dynamic>;
   py::classh<PathD> path(handle, "Path");
   path.def("__call__", &PathD::operator(), "lengths"_a,
@@ -276,13 +423,28 @@ Args:
 Returns:
     Points: points at given path lengths.
 )doc")
-      .def("lengths", &PathD::lengths, "points"_a,
+      .def("lengths",
+           py::overload_cast<const PointsD &>(&PathD::lengths, py::const_),
+           "points"_a,
            R"doc(Determines next points to the query points.
 
 Args:
     points (Points): query points.
 Returns:
     np.ndarray: next to query points.
+)doc")
+      .def("lengths",
+           py::overload_cast<const PointsD &, const Eigen::ArrayXd &, double>(
+               &PathD::lengths, py::const_),
+           "points"_a, "hints"_a, "window"_a,
+           R"doc(Determines next points to the query points close to previous lengths. Paths without local search ignore the hints.
+
+Args:
+    points (Points): query points.
+    hints (np.ndarray): previous lengths along the path for each query point.
+    window (float): maximum length difference to the hints searched locally.
+Returns:
+    np.ndarray: lengths next to query points.
 )doc")
       .def("tangent", &PathD::tangent, "lengths"_a,
            R"doc(Determines tangent vectors at the given path lengths.
@@ -323,6 +485,19 @@ Args:
     lengths (np.ndarray): lengths along the path.
 Returns:
     np.ndarray: path curvatures.
+)doc")
+      .def("frames",
+           py::overload_cast<const Eigen::ArrayXd &, unsigned int>(
+               &PathD::frames, py::const_),
+           "lengths"_a,
+           "properties"_a = static_cast<unsigned int>(FrameAll),
+           R"doc(Determines the Frenet frames at the given path lengths in a single pass. Only evaluates the gradients required by the requested properties.
+
+Args:
+    lengths (np.ndarray): lengths along the path.
+    properties (int): mask of FrameProperty values to determine.
+Returns:
+    Frames: frames with the requested properties.
 )doc");
 
   using PolychainD = Polychain<Eigen::Dynamic>;
@@ -355,13 +530,266 @@ Returns:
     Points: points at the query lengths.
 )doc")
       .def(
-          "lengths", &PolychainD::lengths, "points"_a,
-          R"doc(Determines next points to the query points. Performs a linear search over all polychain segments to identify the closest one.
+          "lengths",
+          py::overload_cast<const PointsD &>(&PolychainD::lengths, py::const_),
+          "points"_a,
+          R"doc(Determines next points to the query points. Searches the closest polychain segment with the selected Search strategy. All strategies provide the lengths of a linear search over all segments.
+
+Args:
+    points (Points): query points.
+Returns:
+    np.ndarray: next points to query points.
+)doc")
+      .def(
+          "lengths",
+          py::overload_cast<const PointsD &, const Eigen::ArrayXd &, double>(
+              &PolychainD::lengths, py::const_),
+          "points"_a, "hints"_a, "window"_a,
+          R"doc(Determines next points to the query points close to previous lengths. Only searches the segments within window around the hints. Falls back to the selected Search strategy if the closest segment is at the window edge or the hint is not finite.
+
+Args:
+    points (Points): query points.
+    hints (np.ndarray): previous lengths along the polychain for each query point.
+    window (float): maximum length difference to the hints searched locally.
+Returns:
+    np.ndarray: lengths next to query points.
+)doc");
+
+  using SplineD = Spline<Eigen::Dynamic>;
+  py::classh<SplineD>(handle, "Spline", path)
+      .def(
+          py::init<Eigen::ArrayXd, Eigen::ArrayXd>(), "x"_a, "y"_a,
+          R"doc(Construct a new Spline object through Cartesian x- and y-positions. Interpolates the points with quintic polynomials parametrized by arc length, or cubic polynomials for fewer than six points.
+
+Args:
+    x (np.ndarray): coordinates in x-direction along the path.
+    y (np.ndarray): coordinates in y-direction along the path.
+Returns:
+    Spline: Spline object.
+)doc")
+      .def(
+          "setPoints", &SplineD::setPoints, "x"_a, "y"_a,
+          R"doc(Provide new points for the spline. Fits the spans and their arc lengths and updates the bounding boxes.
+
+Args:
+    x (np.ndarray): coordinates in x-direction of new points.
+    y (np.ndarray): coordinates in y-direction of new points.
+)doc")
+      .def("knotLengths", &SplineD::knotLengths,
+           R"doc(Provides the lengths along the spline at the given points.
+
+Returns:
+    np.ndarray: lengths at the points.
+)doc")
+      .def(
+          "__call__", &SplineD::operator(), "lengths"_a,
+          R"doc(Gets points along the spline at the query lengths. Lengths exceeding the spline's domain resolve to the first or last point.
+
+Args:
+    lengths (np.ndarray): query lengths along the spline.
+Returns:
+    Points: points at the query lengths.
+)doc")
+      .def(
+          "lengths",
+          py::overload_cast<const PointsD &>(&SplineD::lengths, py::const_),
+          "points"_a,
+          R"doc(Determines next points to the query points. Projects onto all spans whose bounding boxes are closer than the closest point found so far.
+
+Args:
+    points (Points): query points.
+Returns:
+    np.ndarray: next points to query points.
+)doc")
+      .def(
+          "lengths",
+          py::overload_cast<const PointsD &, const Eigen::ArrayXd &, double>(
+              &SplineD::lengths, py::const_),
+          "points"_a, "hints"_a, "window"_a,
+          R"doc(Determines next points to the query points close to previous lengths. Only projects onto the spline within window around the hints. Falls back to the search over all spans if the closest point is at the window edge or the hint is not finite.
+
+Args:
+    points (Points): query points.
+    hints (np.ndarray): previous lengths along the spline for each query point.
+    window (float): maximum length difference to the hints searched locally.
+Returns:
+    np.ndarray: lengths next to query points.
+)doc");
+
+  using ClothoidSplineD = ClothoidSpline<Eigen::Dynamic>;
+  py::classh<ClothoidSplineD>(handle, "ClothoidSpline", path)
+      .def(
+          py::init<Point, double, Eigen::ArrayXd, Eigen::ArrayXd>(), "start"_a,
+          "heading"_a, "lengths"_a, "curvatures"_a,
+          R"doc(Construct a new ClothoidSpline object from its start pose and the curvatures at the segment boundaries. Curvature changes linearly along each segment.
+
+Args:
+    start (Point): position at the start of the path.
+    heading (float): angle of the tangent at the start of the path.
+    lengths (np.ndarray): lengths along the path at the segment boundaries, starting at zero.
+    curvatures (np.ndarray): curvatures at the segment boundaries.
+Returns:
+    ClothoidSpline: ClothoidSpline object.
+)doc")
+      .def(
+          "setSegments", &ClothoidSplineD::setSegments, "start"_a, "heading"_a,
+          "lengths"_a, "curvatures"_a,
+          R"doc(Provide new segments for the clothoid spline. Splits the segments into arcs of bounded heading change and updates the bounding boxes.
+
+Args:
+    start (Point): position at the start of the path.
+    heading (float): angle of the tangent at the start of the path.
+    lengths (np.ndarray): lengths along the path at the segment boundaries, starting at zero.
+    curvatures (np.ndarray): curvatures at the segment boundaries.
+)doc")
+      .def("arcLengths", &ClothoidSplineD::arcLengths,
+           R"doc(Provides the lengths along the path at the boundaries of the arcs.
+
+Returns:
+    np.ndarray: lengths at the arc boundaries.
+)doc")
+      .def(
+          "__call__", &ClothoidSplineD::operator(), "lengths"_a,
+          R"doc(Gets points along the clothoid spline at the query lengths. Lengths exceeding the path's domain resolve to the first or last point.
+
+Args:
+    lengths (np.ndarray): query lengths along the path.
+Returns:
+    Points: points at the query lengths.
+)doc")
+      .def(
+          "lengths",
+          py::overload_cast<const PointsD &>(&ClothoidSplineD::lengths,
+                                             py::const_),
+          "points"_a,
+          R"doc(Determines next points to the query points. Projects onto all arcs whose bounding boxes are closer than the closest point found so far.
 
 Args:
     points (Points): query points.
 Returns:
     np.ndarray: next points to query points.
+)doc")
+      .def(
+          "lengths",
+          py::overload_cast<const PointsD &, const Eigen::ArrayXd &, double>(
+              &ClothoidSplineD::lengths, py::const_),
+          "points"_a, "hints"_a, "window"_a,
+          R"doc(Determines next points to the query points close to previous lengths. Only projects onto the path within window around the hints. Falls back to the search over all arcs if the closest point is at the window edge or the hint is not finite.
+
+Args:
+    points (Points): query points.
+    hints (np.ndarray): previous lengths along the path for each query point.
+    window (float): maximum length difference to the hints searched locally.
+Returns:
+    np.ndarray: lengths next to query points.
+)doc");
+
+  using ArcChainD = ArcChain<Eigen::Dynamic>;
+  py::classh<ArcChainD>(handle, "ArcChain", path)
+      .def(
+          py::init<Point, double, Eigen::ArrayXd, Eigen::ArrayXd>(), "start"_a,
+          "heading"_a, "lengths"_a, "curvatures"_a,
+          R"doc(Construct a new ArcChain object from its start pose and the curvature of each segment. Segments are lines for zero curvature and circular arcs otherwise, joined with continuous tangents.
+
+Args:
+    start (Point): position at the start of the path.
+    heading (float): angle of the tangent at the start of the path.
+    lengths (np.ndarray): lengths along the path at the segment boundaries, starting at zero.
+    curvatures (np.ndarray): curvatures of the segments, one less than lengths.
+Returns:
+    ArcChain: ArcChain object.
+)doc")
+      .def(
+          "setSegments", &ArcChainD::setSegments, "start"_a, "heading"_a,
+          "lengths"_a, "curvatures"_a,
+          R"doc(Provide new segments for the arc chain. Determines the start poses of the segments and rebuilds the segment tree.
+
+Args:
+    start (Point): position at the start of the path.
+    heading (float): angle of the tangent at the start of the path.
+    lengths (np.ndarray): lengths along the path at the segment boundaries, starting at zero.
+    curvatures (np.ndarray): curvatures of the segments, one less than lengths.
+)doc")
+      .def("segmentLengths", &ArcChainD::segmentLengths,
+           R"doc(Provides the lengths along the path at the segment boundaries.
+
+Returns:
+    np.ndarray: lengths at the segment boundaries.
+)doc")
+      .def(
+          "__call__", &ArcChainD::operator(), "lengths"_a,
+          R"doc(Gets points along the arc chain at the query lengths. Lengths exceeding the path's domain resolve to the first or last point.
+
+Args:
+    lengths (np.ndarray): query lengths along the path.
+Returns:
+    Points: points at the query lengths.
+)doc")
+      .def(
+          "lengths",
+          py::overload_cast<const PointsD &>(&ArcChainD::lengths, py::const_),
+          "points"_a,
+          R"doc(Determines next points to the query points. Projects exactly onto the segments whose bounding boxes are closer than the closest point found so far.
+
+Args:
+    points (Points): query points.
+Returns:
+    np.ndarray: next points to query points.
+)doc")
+      .def(
+          "lengths",
+          py::overload_cast<const PointsD &, const Eigen::ArrayXd &, double>(
+              &ArcChainD::lengths, py::const_),
+          "points"_a, "hints"_a, "window"_a,
+          R"doc(Determines next points to the query points close to previous lengths. Only projects onto the path within window around the hints. Falls back to the search over all segments if the closest point is at the window edge or the hint is not finite.
+
+Args:
+    points (Points): query points.
+    hints (np.ndarray): previous lengths along the path for each query point.
+    window (float): maximum length difference to the hints searched locally.
+Returns:
+    np.ndarray: lengths next to query points.
+)doc");
+
+  py::classh<Simplified>(
+      handle, "Simplified",
+      R"doc(Points of a simplified polychain and the errors introduced by the simplification.)doc")
+      .def_readonly("points", &Simplified::points,
+                    "kept points in original order")
+      .def_readonly("indices", &Simplified::indices,
+                    "indices of kept original points")
+      .def_readonly("deviation", &Simplified::deviation,
+                    "maximum distance of original points to chain")
+      .def_readonly("curvatureError", &Simplified::curvatureError,
+                    "maximum difference of curvatures");
+
+  handle.def(
+      "simplify", &simplify, "x"_a, "y"_a, "deviationMax"_a,
+      "curvatureErrorMax"_a = std::numeric_limits<double>::infinity(),
+      R"doc(Removes points of a polychain within a lateral deviation and a curvature error. Keeps the first and last point. Splits segments exceeding the curvature error until no error exceeds the bound or only original segments remain.
+
+Args:
+    x (np.ndarray): coordinates in x-direction along the path.
+    y (np.ndarray): coordinates in y-direction along the path.
+    deviationMax (float): maximum distance of removed points to the simplified polychain.
+    curvatureErrorMax (float): maximum absolute difference of curvatures.
+Returns:
+    Simplified: kept points and the achieved errors.
+)doc");
+
+  handle.def(
+      "resample", &resample, "path"_a, "lengthBegin"_a, "lengthEnd"_a,
+      "numPoints"_a, "growthMax"_a = 2.0,
+      R"doc(Lengths of polychain points along a path which distribute a fixed number of points according to the local curvature and curvature rate. Equalizes the heading error of the polychain segments. Adjacent spacings grow by at most growthMax.
+
+Args:
+    path (Path): path to sample.
+    lengthBegin (float): length of the first point.
+    lengthEnd (float): length of the last point.
+    numPoints (int): number of points, at least two.
+    growthMax (float): maximum ratio of adjacent spacings, larger than one.
+Returns:
+    np.ndarray: ascending lengths from lengthBegin to lengthEnd.
 )doc");
 
   using TransformD = Transform<Eigen::Dynamic>;
@@ -375,7 +803,10 @@ Returns:
     Transform: Transform object.
 )doc")
       .def(
-          "posFrenet", &TransformD::posFrenet, "posCartes"_a,
+          "posFrenet",
+          py::overload_cast<const PointsD &>(&TransformD::posFrenet,
+                                             py::const_),
+          "posCartes"_a,
           R"doc(Transform Cartesian positions to Frenet positions. Projects the query points onto the path. Determines the signed lengths along the path from the path origin to the projections. Determines the signed shortest distances to the query point.
 
 Args:
@@ -383,7 +814,24 @@ Args:
 Returns:
     Points: result points in Frenet coordinates.
 )doc")
-      .def("posCartes", &TransformD::posCartes, "posFrenet"_a,
+      .def(
+          "posFrenet",
+          py::overload_cast<const PointsD &, const Eigen::ArrayXd &, double>(
+              &TransformD::posFrenet, py::const_),
+          "posCartes"_a, "hints"_a, "window"_a,
+          R"doc(Transform Cartesian positions to Frenet positions close to previous lengths. Tracked query points search the path locally around their previous lengths.
+
+Args:
+    posCartes (Points): query points in Cartesian coordinates.
+    hints (np.ndarray): previous lengths along the path for each query point.
+    window (float): maximum length difference to the hints searched locally.
+Returns:
+    Points: result points in Frenet coordinates.
+)doc")
+      .def("posCartes",
+           py::overload_cast<const PointsD &>(&TransformD::posCartes,
+                                              py::const_),
+           "posFrenet"_a,
            R"doc(Transform Frenet positions to Cartesian positions.
 
 Args:
@@ -391,7 +839,10 @@ Args:
 Returns:
     Points: result points in Cartesian coordinates.
 )doc")
-      .def("velFrenet", &TransformD::velFrenet, "velCartes"_a, "posFrenet"_a,
+      .def("velFrenet",
+           py::overload_cast<const PointsD &, const PointsD &>(
+               &TransformD::velFrenet, py::const_),
+           "velCartes"_a, "posFrenet"_a,
            R"doc(Transform Cartesian velocities to Frenet velocities.
 
 Args:
@@ -400,7 +851,10 @@ Args:
 Returns:
     Points: result velocities in Frenet coordinates.
 )doc")
-      .def("velCartes", &TransformD::velCartes, "velFrenet"_a, "posFrenet"_a,
+      .def("velCartes",
+           py::overload_cast<const PointsD &, const PointsD &>(
+               &TransformD::velCartes, py::const_),
+           "velFrenet"_a, "posFrenet"_a,
            R"doc(Transform Frenet velocities to Cartesian velocities.
 
 Args:
@@ -409,8 +863,11 @@ Args:
 Returns:
     Points: result velocities in Cartesian coordinates.
 )doc")
-      .def("accFrenet", &TransformD::accFrenet, "accCartes"_a, "velFrenet"_a,
-           "posFrenet"_a,
+      .def("accFrenet",
+           py::overload_cast<const PointsD &, const PointsD &,
+                             const PointsD &>(&TransformD::accFrenet,
+                                              py::const_),
+           "accCartes"_a, "velFrenet"_a, "posFrenet"_a,
            R"doc(Transform Cartesian accelerations to Frenet accelerations.
 
 Args:
@@ -420,8 +877,11 @@ Args:
 Returns:
     Points: result accelerations in Frenet coordinates.
 )doc")
-      .def("accCartes", &TransformD::accCartes, "accFrenet"_a, "velFrenet"_a,
-           "posFrenet"_a,
+      .def("accCartes",
+           py::overload_cast<const PointsD &, const PointsD &,
+                             const PointsD &>(&TransformD::accCartes,
+                                              py::const_),
+           "accFrenet"_a, "velFrenet"_a, "posFrenet"_a,
            R"doc(Transform Frenet accelerations to Cartesian accelerations.
 
 Args:
@@ -430,6 +890,192 @@ Args:
     posFrenet (Points): positions corresponding to accelerations in Frenet coordinates.
 Returns:
     Points: result accelerations in Cartesian coordinates.
+)doc")
+      .def(
+          "stateFrenet",
+          py::overload_cast<const PointsD &, const PointsD &, const PointsD &>(
+              &TransformD::stateFrenet, py::const_),
+          "posCartes"_a, "velCartes"_a, "accCartes"_a,
+          R"doc(Transform Cartesian states to Frenet states. Projects the query points onto the path and evaluates the path properties and transformation matrices once for positions, velocities and accelerations.
+
+Args:
+    posCartes (Points): query positions in Cartesian coordinates.
+    velCartes (Points): query velocities in Cartesian coordinates.
+    accCartes (Points): query accelerations in Cartesian coordinates.
+Returns:
+    States: result states in Frenet coordinates.
+)doc")
+      .def("stateFrenet",
+           py::overload_cast<const PointsD &, const PointsD &, const PointsD &,
+                             const Eigen::ArrayXd &, double>(
+               &TransformD::stateFrenet, py::const_),
+           "posCartes"_a, "velCartes"_a, "accCartes"_a, "hints"_a, "window"_a,
+           R"doc(Transform Cartesian states to Frenet states close to previous lengths. Tracked query points search the path locally around their previous lengths.
+
+Args:
+    posCartes (Points): query positions in Cartesian coordinates.
+    velCartes (Points): query velocities in Cartesian coordinates.
+    accCartes (Points): query accelerations in Cartesian coordinates.
+    hints (np.ndarray): previous lengths along the path for each query point.
+    window (float): maximum length difference to the hints searched locally.
+Returns:
+    States: result states in Frenet coordinates.
+)doc")
+      .def("stateCartes",
+           py::overload_cast<const PointsD &, const PointsD &,
+                             const PointsD &>(&TransformD::stateCartes,
+                                              py::const_),
+           "posFrenet"_a, "velFrenet"_a, "accFrenet"_a,
+           R"doc(Transform Frenet states to Cartesian states. Evaluates the path properties and transformation matrices once for positions, velocities and accelerations.
+
+Args:
+    posFrenet (Points): query positions in Frenet coordinates.
+    velFrenet (Points): query velocities in Frenet coordinates.
+    accFrenet (Points): query accelerations in Frenet coordinates.
+Returns:
+    States: result states in Cartesian coordinates.
+)doc")
+      .def("frameSet",
+           py::overload_cast<const PointsD &>(&TransformD::frameSet,
+                                              py::const_),
+           "posFrenet"_a,
+           R"doc(Bind the Frenet frames and transformation matrices to Frenet positions once, such that velocities and accelerations at these positions are transformed without evaluating the path again.
+
+Args:
+    posFrenet (Points): positions in Frenet coordinates.
+Returns:
+    FrameSet: frames bound to the positions.
+)doc")
+      .def("posFrenet",
+           py::overload_cast<const Point &>(&TransformD::posFrenet,
+                                            py::const_),
+           "posCartes"_a,
+           R"doc(Transform a single Cartesian position to a Frenet position without arrays.
+
+Args:
+    posCartes (Point): query point in Cartesian coordinates.
+Returns:
+    Point: result point in Frenet coordinates.
+)doc")
+      .def("posFrenet",
+           py::overload_cast<const Point &, double, double>(
+               &TransformD::posFrenet, py::const_),
+           "posCartes"_a, "hint"_a, "window"_a,
+           R"doc(Transform a single Cartesian position to a Frenet position close to a previous length without arrays.
+
+Args:
+    posCartes (Point): query point in Cartesian coordinates.
+    hint (float): previous length along the path.
+    window (float): maximum length difference to the hint searched locally.
+Returns:
+    Point: result point in Frenet coordinates.
+)doc")
+      .def("posCartes",
+           py::overload_cast<const Point &>(&TransformD::posCartes,
+                                            py::const_),
+           "posFrenet"_a,
+           R"doc(Transform a single Frenet position to a Cartesian position without arrays.
+
+Args:
+    posFrenet (Point): query point in Frenet coordinates.
+Returns:
+    Point: result point in Cartesian coordinates.
+)doc")
+      .def("stateFrenet",
+           py::overload_cast<const Point &, const Point &, const Point &>(
+               &TransformD::stateFrenet, py::const_),
+           "posCartes"_a, "velCartes"_a, "accCartes"_a,
+           R"doc(Transform a single Cartesian state to a Frenet state without arrays.
+
+Args:
+    posCartes (Point): query position in Cartesian coordinates.
+    velCartes (Point): query velocity in Cartesian coordinates.
+    accCartes (Point): query acceleration in Cartesian coordinates.
+Returns:
+    State: result state in Frenet coordinates.
+)doc")
+      .def("stateCartes",
+           py::overload_cast<const Point &, const Point &, const Point &>(
+               &TransformD::stateCartes, py::const_),
+           "posFrenet"_a, "velFrenet"_a, "accFrenet"_a,
+           R"doc(Transform a single Frenet state to a Cartesian state without arrays.
+
+Args:
+    posFrenet (Point): query position in Frenet coordinates.
+    velFrenet (Point): query velocity in Frenet coordinates.
+    accFrenet (Point): query acceleration in Frenet coordinates.
+Returns:
+    State: result state in Cartesian coordinates.
+)doc")
+      .def(
+          "posFrenetJacobians",
+          [](const TransformD &transform, const PointsD &posCartes) {
+            Jacobians<> jacobians{};
+            PointsD result{transform.posFrenet(posCartes, jacobians)};
+            return std::make_tuple(std::move(result), toArray(jacobians.pos));
+          },
+          "posCartes"_a,
+          R"doc(Transform Cartesian positions to Frenet positions with the Jacobians of the Frenet positions by the Cartesian positions.
+
+Args:
+    posCartes (Points): query points in Cartesian coordinates.
+Returns:
+    Tuple[Points, np.ndarray]: result points in Frenet coordinates and Jacobians of shape (numQueries, 2, 2).
+)doc")
+      .def(
+          "posCartesJacobians",
+          [](const TransformD &transform, const PointsD &posFrenet) {
+            Jacobians<> jacobians{};
+            PointsD result{transform.posCartes(posFrenet, jacobians)};
+            return std::make_tuple(std::move(result), toArray(jacobians.pos));
+          },
+          "posFrenet"_a,
+          R"doc(Transform Frenet positions to Cartesian positions with the Jacobians of the Cartesian positions by the Frenet positions.
+
+Args:
+    posFrenet (Points): query points in Frenet coordinates.
+Returns:
+    Tuple[Points, np.ndarray]: result points in Cartesian coordinates and Jacobians of shape (numQueries, 2, 2).
+)doc")
+      .def(
+          "velFrenetJacobians",
+          [](const TransformD &transform, const PointsD &velCartes,
+             const PointsD &posFrenet) {
+            Jacobians<> jacobians{};
+            PointsD result{
+                transform.velFrenet(velCartes, posFrenet, jacobians)};
+            return std::make_tuple(std::move(result),
+                                   toArray(jacobians.velByVel),
+                                   toArray(jacobians.velByPos));
+          },
+          "velCartes"_a, "posFrenet"_a,
+          R"doc(Transform Cartesian velocities to Frenet velocities with the Jacobians of the Frenet velocities by the Cartesian velocities and by the Frenet positions.
+
+Args:
+    velCartes (Points): query velocities in Cartesian coordinates.
+    posFrenet (Points): positions corresponding to velocities in Frenet coordinates.
+Returns:
+    Tuple[Points, np.ndarray, np.ndarray]: result velocities in Frenet coordinates and Jacobians by velocities and by positions of shape (numQueries, 2, 2).
+)doc")
+      .def(
+          "velCartesJacobians",
+          [](const TransformD &transform, const PointsD &velFrenet,
+             const PointsD &posFrenet) {
+            Jacobians<> jacobians{};
+            PointsD result{
+                transform.velCartes(velFrenet, posFrenet, jacobians)};
+            return std::make_tuple(std::move(result),
+                                   toArray(jacobians.velByVel),
+                                   toArray(jacobians.velByPos));
+          },
+          "velFrenet"_a, "posFrenet"_a,
+          R"doc(Transform Frenet velocities to Cartesian velocities with the Jacobians of the Cartesian velocities by the Frenet velocities and by the Frenet positions.
+
+Args:
+    velFrenet (Points): query velocities in Frenet coordinates.
+    posFrenet (Points): positions corresponding to velocities in Frenet coordinates.
+Returns:
+    Tuple[Points, np.ndarray, np.ndarray]: result velocities in Cartesian coordinates and Jacobians by velocities and by positions of shape (numQueries, 2, 2).
 )doc");
 }
 } // namespace FrenetTransform
\ No newline at end of file
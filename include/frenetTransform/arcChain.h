@@ -0,0 +1,387 @@
+#ifndef ARC_CHAIN_H
+#define ARC_CHAIN_H
+
+#include <Eigen/Core>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "frenetTransform/frames.h"
+#include "frenetTransform/internal/math.h"
+#include "frenetTransform/internal/pointwisePath.h"
+#include "frenetTransform/internal/segmentTree.h"
+#include "frenetTransform/point.h"
+#include "frenetTransform/points.h"
+
+namespace FrenetTransform {
+/**
+ * @brief Path representation as sequence of lines and circular arcs.
+ * Each segment has constant curvature, zero for lines, and the tangent is
+ * continuous between segments, such that chains of biarcs describe tracks and
+ * parking paths with a few segments instead of many polychain points.
+ *
+ * Points, tangents and curvatures are exact up to rounding. Query points are
+ * projected onto each segment in closed form, which is the foot point for
+ * lines and the point in the direction of the query point from the center for
+ * arcs. Segments are only projected onto if their bounding box in a segment
+ * tree is closer than the closest point found so far.
+ *
+ * @tparam NumQueries number of query points with -1 for dynamic point number.
+ * @tparam Scalar floating point type of the query points and properties.
+ */
+template <int NumQueries = Eigen::Dynamic, typename Scalar = double>
+class ArcChain : public Internal::PointwisePath<NumQueries, Scalar> {
+public:
+  ArcChain() = default;
+
+  /**
+   * @brief Construct a new ArcChain object from its start pose and the
+   * curvature of each segment.
+   *
+   * @param start point at the path start.
+   * @param heading tangent angle at the path start.
+   * @param lengths ascending lengths along the path at the segment
+   * boundaries.
+   * @param curvatures curvatures of the segments, one less than "lengths".
+   */
+  ArcChain(const Point &start, double heading, const Eigen::ArrayXd &lengths,
+           const Eigen::ArrayXd &curvatures) {
+    setSegments(start, heading, lengths, curvatures);
+  }
+
+  /**
+   * @brief Determines the Frenet frame at a single path length without
+   * arrays or allocation. Lengths exceeding the domain resolve to the first
+   * or last point.
+   *
+   * @param length length along the path.
+   * @param properties mask of FrameProperty values to determine.
+   * @return Frame<Scalar> frame with the requested properties.
+   */
+  Frame<Scalar> frame(Scalar length,
+                      unsigned int properties = FrameAll) const final {
+    const int segment{segmentAt(length)};
+    const double part{partAt(length, segment)};
+
+    Frame<Scalar> result{};
+    if (properties & FramePoints)
+      result.point = BasicPoint<Scalar>{pointAt(segment, part)};
+    if (properties & FrameTangents) {
+      const double heading{headingAt(segment, part)};
+      result.tangent = BasicPoint<Scalar>{
+          Point{std::cos(heading), std::sin(heading)}};
+      result.normal = BasicPoint<Scalar>{
+          Point{-std::sin(heading), std::cos(heading)}};
+    }
+    if (properties & FrameCurvatures)
+      result.curvature = m_segments[segment].curvature;
+    // curvature is piecewise constant
+    if (properties & FrameCurvatureRates)
+      result.curvatureRate = 0.0;
+    return result;
+  }
+
+  /**
+   * @brief Determines the next point to a single query point without arrays
+   * or allocation.
+   *
+   * @param point query point.
+   * @return Scalar length next to the query point.
+   */
+  Scalar length(const BasicPoint<Scalar> &point) const final {
+    return nearest(Point{point}).length;
+  }
+
+  /**
+   * @brief Determines the next point to a single query point close to a
+   * previous length without arrays or allocation. Only projects onto the arc
+   * chain within "window" around the hint. Falls back to the search over all
+   * segments if the closest point is at the window edge or the hint is not
+   * finite.
+   *
+   * @param point query point.
+   * @param hint previous length along the path.
+   * @param window maximum length difference to the hint searched locally.
+   * @return Scalar length next to the query point.
+   */
+  Scalar length(const BasicPoint<Scalar> &point, Scalar hint,
+                Scalar window) const final {
+    return nearest(Point{point}, hint, window).length;
+  }
+
+  /**
+   * @brief Provide new segments for the arc chain.
+   * Determines the start poses of the segments from the preceding ones and
+   * builds the segment tree over their bounding boxes. Segments without
+   * positive length are skipped.
+   *
+   * @param start point at the path start.
+   * @param heading tangent angle at the path start.
+   * @param lengths ascending lengths along the path at the segment
+   * boundaries.
+   * @param curvatures curvatures of the segments, one less than "lengths".
+   */
+  void setSegments(const Point &start, double heading,
+                   const Eigen::ArrayXd &lengths,
+                   const Eigen::ArrayXd &curvatures) {
+    m_segments.clear();
+    std::vector<double> segmentLengths{lengths.size() > 0 ? lengths(0) : 0.0};
+
+    Segment next{start, heading};
+    for (int segment{}; segment < lengths.rows() - 1; ++segment) {
+      const double length{lengths(segment + 1) - lengths(segment)};
+      if (!(length > 0.0))
+        continue;
+
+      next.curvature = curvatures(segment);
+      m_segments.push_back(next);
+      segmentLengths.push_back(lengths(segment + 1));
+
+      next.start = pointAt(numSegments() - 1, length);
+      next.heading = headingAt(numSegments() - 1, length);
+    }
+
+    m_lengths = Eigen::Map<const Eigen::ArrayXd>(
+        segmentLengths.data(), static_cast<int>(segmentLengths.size()));
+    std::vector<Internal::Box> boxes(m_segments.size());
+    for (int segment{}; segment < numSegments(); ++segment)
+      boxes[segment] = box(segment);
+    m_tree = Internal::SegmentTree{std::move(boxes)};
+  }
+
+  /**
+   * @brief Provides the lengths along the arc chain at the segment
+   * boundaries, excluding skipped segments.
+   *
+   * @return const Eigen::ArrayXd& lengths at the segment boundaries.
+   */
+  const Eigen::ArrayXd &segmentLengths() const { return m_lengths; }
+
+private:
+  /**
+   * @brief Line or circular arc with its start pose.
+   *
+   */
+  struct Segment {
+    Point start{};      /**<< point at the segment start */
+    double heading{};   /**<< tangent angle at the segment start */
+    double curvature{}; /**<< signed curvature, zero for lines */
+  };
+
+  /**
+   * @brief Closest point on the arc chain to a query point.
+   *
+   */
+  struct Nearest {
+    // squared distance between query point and arc chain
+    double distanceSquare{std::numeric_limits<double>::infinity()};
+    double length{}; /**<< length along the arc chain */
+    int segment{};   /**<< index of the segment */
+  };
+
+  std::vector<Segment> m_segments{}; /**<< segments along the path */
+  Eigen::ArrayXd m_lengths{}; /**<< lengths at the segment boundaries */
+  Internal::SegmentTree m_tree{}; /**<< tree over the segment boxes */
+
+  /**
+   * @brief Provides the number of segments.
+   *
+   * @return int number of segments.
+   */
+  int numSegments() const { return static_cast<int>(m_segments.size()); }
+
+  /**
+   * @brief Provides the length of a segment.
+   *
+   * @param segment index of the segment.
+   * @return double difference between the lengths at the segment ends.
+   */
+  double segmentLength(int segment) const {
+    return m_lengths(segment + 1) - m_lengths(segment);
+  }
+
+  /**
+   * @brief Determines the segment containing the given length.
+   * Lengths exceeding the domain resolve to the first or last segment.
+   *
+   * @param length length along the arc chain.
+   * @return int index of the segment.
+   */
+  int segmentAt(double length) const {
+    return std::clamp(FrenetTransform::firstSorted(m_lengths, length) - 1, 0,
+                      numSegments() - 1);
+  }
+
+  /**
+   * @brief Determines the length within a segment at the given length,
+   * clamped to the segment.
+   *
+   * @param length length along the arc chain.
+   * @param segment index of the segment.
+   * @return double length relative to the segment start.
+   */
+  double partAt(double length, int segment) const {
+    return std::clamp(length - m_lengths(segment), 0.0,
+                      segmentLength(segment));
+  }
+
+  /**
+   * @brief Determines the point within a segment. Moves along the chord,
+   * whose direction halves the heading change, which avoids cancellation for
+   * small curvatures and includes lines.
+   *
+   * @param segment index of the segment.
+   * @param part length relative to the segment start.
+   * @return Point along the segment.
+   */
+  Point pointAt(int segment, double part) const {
+    const Segment &arc{m_segments[segment]};
+    const double halfAngle{arc.curvature * part / 2};
+    const double chord{
+        halfAngle == 0.0 ? part : part * std::sin(halfAngle) / halfAngle};
+    const double heading{arc.heading + halfAngle};
+    return {arc.start.x() + chord * std::cos(heading),
+            arc.start.y() + chord * std::sin(heading)};
+  }
+
+  /**
+   * @brief Determines the tangent angle within a segment.
+   *
+   * @param segment index of the segment.
+   * @param part length relative to the segment start.
+   * @return double tangent angle along the segment.
+   */
+  double headingAt(int segment, double part) const {
+    return m_segments[segment].heading + part * m_segments[segment].curvature;
+  }
+
+  /**
+   * @brief Determines the bounding box of a segment from its ends and the
+   * extreme points of the circle, where the tangent is axis-aligned.
+   *
+   * @param segment index of the segment.
+   * @return Internal::Box bounding box of the segment.
+   */
+  Internal::Box box(int segment) const {
+    const double length{segmentLength(segment)};
+    Internal::Box result{};
+    result.extend(m_segments[segment].start);
+    result.extend(pointAt(segment, length));
+
+    const double curvature{m_segments[segment].curvature};
+    if (curvature == 0.0)
+      return result;
+
+    // tangent angles at multiples of a quarter turn within the segment
+    const double heading{m_segments[segment].heading};
+    const double headingEnd{headingAt(segment, length)};
+    const double quarter{M_PI / 2};
+    for (double angle{std::ceil(std::min(heading, headingEnd) / quarter) *
+                      quarter};
+         angle <= std::max(heading, headingEnd); angle += quarter)
+      result.extend(pointAt(segment, (angle - heading) / curvature));
+    return result;
+  }
+
+  /**
+   * @brief Determines the closest point on the arc chain to a query point.
+   * Visits the segments in the segment tree nearest first. Equally distant
+   * segments resolve to the one with the smallest index.
+   *
+   * @param point query point.
+   * @return Nearest closest point on the arc chain.
+   */
+  Nearest nearest(const Point &point) const {
+    Nearest result{};
+    m_tree.nearest(point, [this, &point, &result](int segment) {
+      project(segment - 1, 0.0, segmentLength(segment - 1), point, result);
+      return result.distanceSquare;
+    });
+    return result;
+  }
+
+  /**
+   * @brief Determines the closest point on the arc chain to a query point
+   * within "window" around the length "hint".
+   *
+   * @param point query point.
+   * @param hint previous length along the arc chain.
+   * @param window maximum length difference to "hint" searched locally.
+   * @return Nearest closest point on the arc chain.
+   */
+  Nearest nearest(const Point &point, double hint, double window) const {
+    if (numSegments() == 0 || !std::isfinite(hint))
+      return nearest(point);
+
+    const double lengthMin{m_lengths(0)};
+    const double lengthMax{m_lengths(numSegments())};
+    const double lower{
+        std::clamp(hint - std::abs(window), lengthMin, lengthMax)};
+    const double upper{
+        std::clamp(hint + std::abs(window), lengthMin, lengthMax)};
+
+    Nearest result{};
+    for (int segment{segmentAt(lower)}; segment <= segmentAt(upper);
+         ++segment)
+      project(segment, partAt(lower, segment), partAt(upper, segment), point,
+              result);
+
+    if ((result.length <= lower && lower > lengthMin) ||
+        (result.length >= upper && upper < lengthMax))
+      return nearest(point);
+
+    return result;
+  }
+
+  /**
+   * @brief Projects a query point onto a segment between the lengths
+   * "partMin" and "partMax" and updates the closest point.
+   * The angle to the query point seen from the center, relative to the
+   * segment start, follows from the query point in the frame of the segment
+   * start and reduces to the foot point for lines. Closest points on the
+   * circle outside the length limits resolve to the nearer limit.
+   *
+   * @param segment index of the segment.
+   * @param partMin lower length limit relative to the segment start.
+   * @param partMax upper length limit relative to the segment start.
+   * @param point query point.
+   * @param result closest point found so far, updated in place.
+   */
+  void project(int segment, double partMin, double partMax,
+               const Point &point, Nearest &result) const {
+    const Segment &arc{m_segments[segment]};
+    const Point diff{point - arc.start};
+    const double cos{std::cos(arc.heading)};
+    const double sin{std::sin(arc.heading)};
+    const double along{diff.x() * cos + diff.y() * sin};
+    const double lateral{diff.y() * cos - diff.x() * sin};
+
+    double part{along};
+    if (arc.curvature != 0.0) {
+      part = std::atan2(arc.curvature * along,
+                        1.0 - arc.curvature * lateral) /
+             arc.curvature;
+      // closest point behind the start continues around the circle
+      if (part < 0.0)
+        part += 2 * M_PI / std::abs(arc.curvature);
+    }
+
+    std::array<double, 2> candidates{part, part};
+    if (!(part >= partMin && part <= partMax))
+      candidates = {partMin, partMax};
+    for (const double candidate : candidates) {
+      const double distanceSquare{
+          pointAt(segment, candidate).distanceSquare(point)};
+      if (distanceSquare < result.distanceSquare ||
+          (distanceSquare == result.distanceSquare &&
+           segment < result.segment))
+        result = {distanceSquare, m_lengths(segment) + candidate, segment};
+    }
+  }
+};
+}; // namespace FrenetTransform
+
+#endif
@@ -0,0 +1,421 @@
+#ifndef CLOTHOID_SPLINE_H
+#define CLOTHOID_SPLINE_H
+
+#include <Eigen/Core>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "frenetTransform/frames.h"
+#include "frenetTransform/internal/math.h"
+#include "frenetTransform/internal/pointwisePath.h"
+#include "frenetTransform/internal/segmentTree.h"
+#include "frenetTransform/point.h"
+#include "frenetTransform/points.h"
+
+namespace FrenetTransform {
+/**
+ * @brief Path representation as sequence of clothoid segments.
+ * The curvature changes linearly along each segment and continuously between
+ * segments, which includes lines and circular arcs as segments of constant
+ * curvature. Curvatures and curvature derivatives are exact and tangents are
+ * exact up to rounding.
+ *
+ * Segments are split into arcs with heading changes below a quarter radian at
+ * construction. Points along an arc are the generalized Fresnel integrals from
+ * the arc start, such that any length evaluates in constant time after
+ * locating its arc.
+ *
+ * Query points are projected onto the arcs with Newton's method, starting
+ * from the projection onto the chord of the arc. Arcs are only projected onto
+ * if their bounding box in a segment tree is closer than the closest point
+ * found so far.
+ *
+ * @tparam NumQueries number of query points with -1 for dynamic point number.
+ * @tparam Scalar floating point type of the query points and properties.
+ */
+template <int NumQueries = Eigen::Dynamic, typename Scalar = double>
+class ClothoidSpline : public Internal::PointwisePath<NumQueries, Scalar> {
+public:
+  ClothoidSpline() = default;
+
+  /**
+   * @brief Construct a new ClothoidSpline object from its start pose and the
+   * curvatures at the segment boundaries.
+   *
+   * @param start point at the path start.
+   * @param heading tangent angle at the path start.
+   * @param lengths ascending lengths along the path at the segment
+   * boundaries.
+   * @param curvatures curvatures at the segment boundaries.
+   */
+  ClothoidSpline(const Point &start, double heading,
+                 const Eigen::ArrayXd &lengths,
+                 const Eigen::ArrayXd &curvatures) {
+    setSegments(start, heading, lengths, curvatures);
+  }
+
+  /**
+   * @brief Determines the Frenet frame at a single path length without
+   * arrays or allocation. Lengths exceeding the domain resolve to the first
+   * or last point.
+   *
+   * @param length length along the path.
+   * @param properties mask of FrameProperty values to determine.
+   * @return Frame<Scalar> frame with the requested properties.
+   */
+  Frame<Scalar> frame(Scalar length,
+                      unsigned int properties = FrameAll) const final {
+    const int arc{arcAt(length)};
+    const double part{partAt(length, arc)};
+
+    Frame<Scalar> result{};
+    if (properties & FramePoints)
+      result.point = BasicPoint<Scalar>{pointAt(arc, part)};
+    if (properties & FrameTangents) {
+      const double heading{headingAt(arc, part)};
+      result.tangent = BasicPoint<Scalar>{
+          Point{std::cos(heading), std::sin(heading)}};
+      result.normal = BasicPoint<Scalar>{
+          Point{-std::sin(heading), std::cos(heading)}};
+    }
+    if (properties & FrameCurvatures)
+      result.curvature = m_arcs[arc].curvature + part * m_arcs[arc].sharpness;
+    if (properties & FrameCurvatureRates)
+      result.curvatureRate = m_arcs[arc].sharpness;
+    return result;
+  }
+
+  /**
+   * @brief Determines the next point to a single query point without arrays
+   * or allocation.
+   *
+   * @param point query point.
+   * @return Scalar length next to the query point.
+   */
+  Scalar length(const BasicPoint<Scalar> &point) const final {
+    return nearest(Point{point}).length;
+  }
+
+  /**
+   * @brief Determines the next point to a single query point close to a
+   * previous length without arrays or allocation. Only projects onto the
+   * clothoid spline within "window" around the hint. Falls back to the search
+   * over all arcs if the closest point is at the window edge or the hint is not
+   * finite.
+   *
+   * @param point query point.
+   * @param hint previous length along the path.
+   * @param window maximum length difference to the hint searched locally.
+   * @return Scalar length next to the query point.
+   */
+  Scalar length(const BasicPoint<Scalar> &point, Scalar hint,
+                Scalar window) const final {
+    return nearest(Point{point}, hint, window).length;
+  }
+
+  /**
+   * @brief Provide new segments for the clothoid spline.
+   * Splits the segments into arcs and determines their start points and the
+   * tree over their bounding boxes.
+   *
+   * @param start point at the path start.
+   * @param heading tangent angle at the path start.
+   * @param lengths ascending lengths along the path at the segment
+   * boundaries.
+   * @param curvatures curvatures at the segment boundaries.
+   */
+  void setSegments(const Point &start, double heading,
+                   const Eigen::ArrayXd &lengths,
+                   const Eigen::ArrayXd &curvatures) {
+    m_arcs.clear();
+    std::vector<double> arcLengths{lengths.size() > 0 ? lengths(0) : 0.0};
+
+    Arc arc{start, heading};
+    for (int segment{}; segment < lengths.rows() - 1; ++segment) {
+      const double segmentLength{lengths(segment + 1) - lengths(segment)};
+      if (!(segmentLength > 0.0))
+        continue;
+
+      // curvature magnitude is maximal at either segment boundary
+      const double curvatureMax{std::max(std::abs(curvatures(segment)),
+                                         std::abs(curvatures(segment + 1)))};
+      const int numArcs{std::max(
+          1, static_cast<int>(
+                 std::ceil(curvatureMax * segmentLength / s_headingMax)))};
+      const double length{segmentLength / numArcs};
+      arc.sharpness =
+          (curvatures(segment + 1) - curvatures(segment)) / segmentLength;
+
+      for (int cArc{}; cArc < numArcs; ++cArc) {
+        arc.curvature = curvatures(segment) + cArc * length * arc.sharpness;
+        m_arcs.push_back(arc);
+        arcLengths.push_back(lengths(segment) + (cArc + 1) * length);
+
+        const std::array<double, 2> displacement{FrenetTransform::fresnel(
+            arc.heading, arc.curvature, arc.sharpness, length)};
+        arc.start = {arc.start.x() + displacement[0],
+                     arc.start.y() + displacement[1]};
+        arc.heading +=
+            length * (arc.curvature + length * arc.sharpness / 2);
+      }
+    }
+    // lengths at the segment boundaries avoid accumulated rounding
+    arcLengths.back() = lengths.size() > 0 ? lengths(lengths.rows() - 1) : 0.0;
+
+    m_lengths = Eigen::Map<const Eigen::ArrayXd>(
+        arcLengths.data(), static_cast<int>(arcLengths.size()));
+    std::vector<Internal::Box> boxes(m_arcs.size());
+    for (int index{}; index < numArcs(); ++index)
+      boxes[index] = box(index);
+    m_tree = Internal::SegmentTree{std::move(boxes)};
+  }
+
+  /**
+   * @brief Provides the lengths along the clothoid spline at the arc
+   * boundaries, which include the segment boundaries.
+   *
+   * @return const Eigen::ArrayXd& lengths at the arc boundaries.
+   */
+  const Eigen::ArrayXd &arcLengths() const { return m_lengths; }
+
+private:
+  /**
+   * @brief Clothoid arc with heading change below a quarter radian.
+   *
+   */
+  struct Arc {
+    Point start{};      /**<< point at the arc start */
+    double heading{};   /**<< tangent angle at the arc start */
+    double curvature{}; /**<< curvature at the arc start */
+    double sharpness{}; /**<< curvature derivative by arc length */
+  };
+
+  /**
+   * @brief Closest point on the clothoid spline to a query point.
+   *
+   */
+  struct Nearest {
+    // squared distance between query point and clothoid spline
+    double distanceSquare{std::numeric_limits<double>::infinity()};
+    double length{}; /**<< length along the clothoid spline */
+    int arc{};       /**<< index of the arc */
+  };
+
+  std::vector<Arc> m_arcs{};      /**<< arcs along the path */
+  Eigen::ArrayXd m_lengths{};     /**<< lengths at the arc boundaries */
+  Internal::SegmentTree m_tree{}; /**<< tree over the arc boxes */
+
+  static constexpr double s_headingMax{0.25}; /**<< heading change per arc */
+  static constexpr int s_numNewton{8}; /**<< maximum Newton steps per arc */
+
+  /**
+   * @brief Provides the number of arcs.
+   *
+   * @return int number of arcs.
+   */
+  int numArcs() const { return static_cast<int>(m_arcs.size()); }
+
+  /**
+   * @brief Provides the length of an arc.
+   *
+   * @param arc index of the arc.
+   * @return double difference between the lengths at the arc ends.
+   */
+  double arcLength(int arc) const {
+    return m_lengths(arc + 1) - m_lengths(arc);
+  }
+
+  /**
+   * @brief Determines the arc containing the given length.
+   * Lengths exceeding the domain resolve to the first or last arc.
+   *
+   * @param length length along the clothoid spline.
+   * @return int index of the arc.
+   */
+  int arcAt(double length) const {
+    return std::clamp(FrenetTransform::firstSorted(m_lengths, length) - 1, 0,
+                      numArcs() - 1);
+  }
+
+  /**
+   * @brief Determines the length within an arc at the given length, clamped
+   * to the arc.
+   *
+   * @param length length along the clothoid spline.
+   * @param arc index of the arc.
+   * @return double length relative to the arc start.
+   */
+  double partAt(double length, int arc) const {
+    return std::clamp(length - m_lengths(arc), 0.0, arcLength(arc));
+  }
+
+  /**
+   * @brief Determines the point within an arc.
+   *
+   * @param arc index of the arc.
+   * @param part length relative to the arc start.
+   * @return Point along the arc.
+   */
+  Point pointAt(int arc, double part) const {
+    const Arc &clothoid{m_arcs[arc]};
+    const std::array<double, 2> displacement{FrenetTransform::fresnel(
+        clothoid.heading, clothoid.curvature, clothoid.sharpness, part)};
+    return {clothoid.start.x() + displacement[0],
+            clothoid.start.y() + displacement[1]};
+  }
+
+  /**
+   * @brief Determines the tangent angle within an arc.
+   *
+   * @param arc index of the arc.
+   * @param part length relative to the arc start.
+   * @return double tangent angle along the arc.
+   */
+  double headingAt(int arc, double part) const {
+    const Arc &clothoid{m_arcs[arc]};
+    return clothoid.heading +
+           part * (clothoid.curvature + part * clothoid.sharpness / 2);
+  }
+
+  /**
+   * @brief Determines a bounding box of an arc. Extends the box of the arc
+   * ends by the largest deviation from the chord for the arc's heading
+   * change.
+   *
+   * @param arc index of the arc.
+   * @return Internal::Box bounding box of the arc.
+   */
+  Internal::Box box(int arc) const {
+    const Arc &clothoid{m_arcs[arc]};
+    const double length{arcLength(arc)};
+    const double headingChange{
+        length * (std::abs(clothoid.curvature) +
+                  length * std::abs(clothoid.sharpness) / 2)};
+    const double margin{length * std::sin(std::min(headingChange, 1.0))};
+
+    Internal::Box ends{};
+    ends.extend(clothoid.start);
+    ends.extend(pointAt(arc, length));
+    Internal::Box result{};
+    result.extend(Point{ends.xMin - margin, ends.yMin - margin});
+    result.extend(Point{ends.xMax + margin, ends.yMax + margin});
+    return result;
+  }
+
+  /**
+   * @brief Determines the closest point on the clothoid spline to a query
+   * point. Visits the arcs in the segment tree nearest first. Equally distant
+   * arcs resolve to the one with the smallest index.
+   *
+   * @param point query point.
+   * @return Nearest closest point on the clothoid spline.
+   */
+  Nearest nearest(const Point &point) const {
+    Nearest result{};
+    m_tree.nearest(point, [this, &point, &result](int segment) {
+      project(segment - 1, 0.0, arcLength(segment - 1), point, result);
+      return result.distanceSquare;
+    });
+    return result;
+  }
+
+  /**
+   * @brief Determines the closest point on the clothoid spline to a query
+   * point within "window" around the length "hint".
+   *
+   * @param point query point.
+   * @param hint previous length along the clothoid spline.
+   * @param window maximum length difference to "hint" searched locally.
+   * @return Nearest closest point on the clothoid spline.
+   */
+  Nearest nearest(const Point &point, double hint, double window) const {
+    if (numArcs() == 0 || !std::isfinite(hint))
+      return nearest(point);
+
+    const double lengthMin{m_lengths(0)};
+    const double lengthMax{m_lengths(numArcs())};
+    const double lower{
+        std::clamp(hint - std::abs(window), lengthMin, lengthMax)};
+    const double upper{
+        std::clamp(hint + std::abs(window), lengthMin, lengthMax)};
+
+    Nearest result{};
+    for (int arc{arcAt(lower)}; arc <= arcAt(upper); ++arc)
+      project(arc, partAt(lower, arc), partAt(upper, arc), point, result);
+
+    if ((result.length <= lower && lower > lengthMin) ||
+        (result.length >= upper && upper < lengthMax))
+      return nearest(point);
+
+    return result;
+  }
+
+  /**
+   * @brief Projects a query point onto an arc between the lengths "partMin"
+   * and "partMax" and updates the closest point.
+   * Refines the projection onto the chord with Newton's method on the
+   * distance derivative and compares it with the length limits.
+   *
+   * @param arc index of the arc.
+   * @param partMin lower length limit relative to the arc start.
+   * @param partMax upper length limit relative to the arc start.
+   * @param point query point.
+   * @param result closest point found so far, updated in place.
+   */
+  void project(int arc, double partMin, double partMax, const Point &point,
+               Nearest &result) const {
+    // projection onto the chord between the length limits
+    const Point start{pointAt(arc, partMin)};
+    const Point end{pointAt(arc, partMax)};
+    const Point chord{end - start};
+    const double chordSquare{chord.x() * chord.x() + chord.y() * chord.y()};
+    const double chordPart{
+        chordSquare > 0.0
+            ? std::clamp(((point.x() - start.x()) * chord.x() +
+                          (point.y() - start.y()) * chord.y()) /
+                             chordSquare,
+                         0.0, 1.0)
+            : 0.0};
+    double part{partMin + chordPart * (partMax - partMin)};
+
+    // roots of the distance derivative
+    for (int cNewton{}; cNewton < s_numNewton; ++cNewton) {
+      const Point diff{pointAt(arc, part) - point};
+      const double heading{headingAt(arc, part)};
+      const double curvature{m_arcs[arc].curvature +
+                             part * m_arcs[arc].sharpness};
+      const double slope{diff.x() * std::cos(heading) +
+                         diff.y() * std::sin(heading)};
+      const double slopeDer{1.0 + curvature * (diff.y() * std::cos(heading) -
+                                               diff.x() * std::sin(heading))};
+      if (!(slopeDer > 0.0))
+        break;
+
+      const double partNext{
+          std::clamp(part - slope / slopeDer, partMin, partMax)};
+      const bool converged{std::abs(partNext - part) <=
+                           std::numeric_limits<double>::epsilon() *
+                               (std::abs(m_lengths(arc)) + partMax)};
+      part = partNext;
+      if (converged)
+        break;
+    }
+
+    // length limits reuse the chord ends
+    const std::array<std::pair<double, double>, 3> candidates{
+        {{part, pointAt(arc, part).distanceSquare(point)},
+         {partMin, start.distanceSquare(point)},
+         {partMax, end.distanceSquare(point)}}};
+    for (const auto &[candidate, distanceSquare] : candidates)
+      if (distanceSquare < result.distanceSquare ||
+          (distanceSquare == result.distanceSquare && arc < result.arc))
+        result = {distanceSquare, m_lengths(arc) + candidate, arc};
+  }
+};
+}; // namespace FrenetTransform
+
+#endif
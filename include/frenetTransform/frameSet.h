@@ -0,0 +1,234 @@
+#ifndef FRAME_SET_H
+#define FRAME_SET_H
+
+#include <Eigen/Core>
+
+#include "frenetTransform/frames.h"
+#include "frenetTransform/internal/matrices2.h"
+#include "frenetTransform/point.h"
+#include "frenetTransform/points.h"
+
+namespace FrenetTransform {
+template <int NumQueries, typename PathType> class Transform;
+
+/**
+ * @brief Frenet frames and transformation matrices bound to fixed Frenet
+ * positions. Provided by Transform::frameSet once for the positions, such
+ * that any number of velocity and acceleration batches at these positions are
+ * transformed without evaluating the path again. The applications are
+ * element-wise and do not allocate if the results are sized to the number of
+ * positions. Results must not alias the inputs.
+ *
+ * @tparam NumQueries number of query points with -1 for dynamic point number.
+ * @tparam Scalar floating point type of the frames and states.
+ */
+template <int NumQueries = Eigen::Dynamic, typename Scalar = double>
+class FrameSet {
+public:
+  using ArrayQueries = Eigen::Array<Scalar, NumQueries, 1>;
+  using PointsQueries = Points<NumQueries, BasicPoint<Scalar>>;
+
+  FrameSet() = default;
+
+  /**
+   * @brief Provide the number of positions the frames are bound to.
+   *
+   * @return int number of positions.
+   */
+  int numQueries() const { return m_posFrenet.numPoints(); }
+
+  /**
+   * @brief Provide the Frenet positions the frames are bound to.
+   *
+   * @return const PointsQueries& positions in Frenet coordinates.
+   */
+  const PointsQueries &posFrenet() const { return m_posFrenet; }
+
+  /**
+   * @brief Provide the Frenet frames at the positions.
+   *
+   * @return const Frames<NumQueries, Scalar>& tangents, normals, curvatures
+   * and curvature derivatives at the positions.
+   */
+  const Frames<NumQueries, Scalar> &frames() const { return m_frames; }
+
+  /**
+   * @brief Provide the transformation matrices from Frenet to Cartesian
+   * velocities, which are the Jacobians of the Cartesian by the Frenet
+   * positions.
+   *
+   * @return const Internal::Matrices2<NumQueries, Scalar>& transformations.
+   */
+  const Internal::Matrices2<NumQueries, Scalar> &velTransforms() const {
+    return m_velTransforms;
+  }
+
+  /**
+   * @brief Provide the transformation matrices from Cartesian to Frenet
+   * velocities, which are the Jacobians of the Frenet by the Cartesian
+   * positions.
+   *
+   * @return const Internal::Matrices2<NumQueries, Scalar>& transformations.
+   */
+  const Internal::Matrices2<NumQueries, Scalar> &velTransformsInv() const {
+    return m_velTransformsInv;
+  }
+
+  /**
+   * @brief Transform Frenet velocities at the positions to Cartesian
+   * velocities.
+   *
+   * @param velFrenet query velocities in Frenet coordinates.
+   * @return PointsQueries result velocities in Cartesian coordinates.
+   */
+  PointsQueries velCartes(const PointsQueries &velFrenet) const {
+    return m_velTransforms.apply(velFrenet);
+  }
+
+  /**
+   * @brief Transform Frenet velocities at the positions to Cartesian
+   * velocities into caller-provided results.
+   *
+   * @param velFrenet query velocities in Frenet coordinates.
+   * @param result velocities in Cartesian coordinates.
+   */
+  void velCartes(const PointsQueries &velFrenet, PointsQueries &result) const {
+    evaluate(m_velTransforms.apply(velFrenet), result);
+  }
+
+  /**
+   * @brief Transform Cartesian velocities at the positions to Frenet
+   * velocities.
+   *
+   * @param velCartes query velocities in Cartesian coordinates.
+   * @return PointsQueries result velocities in Frenet coordinates.
+   */
+  PointsQueries velFrenet(const PointsQueries &velCartes) const {
+    return m_velTransformsInv.apply(velCartes);
+  }
+
+  /**
+   * @brief Transform Cartesian velocities at the positions to Frenet
+   * velocities into caller-provided results.
+   *
+   * @param velCartes query velocities in Cartesian coordinates.
+   * @param result velocities in Frenet coordinates.
+   */
+  void velFrenet(const PointsQueries &velCartes, PointsQueries &result) const {
+    evaluate(m_velTransformsInv.apply(velCartes), result);
+  }
+
+  /**
+   * @brief Transform Frenet accelerations at the positions to Cartesian
+   * accelerations.
+   *
+   * @param accFrenet query accelerations in Frenet coordinates.
+   * @param velFrenet velocities corresponding to accelerations in Frenet
+   * coordinates.
+   * @return PointsQueries result accelerations in Cartesian coordinates.
+   */
+  PointsQueries accCartes(const PointsQueries &accFrenet,
+                          const PointsQueries &velFrenet) const {
+    return m_velTransforms.apply(accFrenet) + accInduced(velFrenet);
+  }
+
+  /**
+   * @brief Transform Frenet accelerations at the positions to Cartesian
+   * accelerations into caller-provided results.
+   *
+   * @param accFrenet query accelerations in Frenet coordinates.
+   * @param velFrenet velocities corresponding to accelerations in Frenet
+   * coordinates.
+   * @param result accelerations in Cartesian coordinates.
+   */
+  void accCartes(const PointsQueries &accFrenet, const PointsQueries &velFrenet,
+                 PointsQueries &result) const {
+    evaluate(m_velTransforms.apply(accFrenet) + accInduced(velFrenet), result);
+  }
+
+  /**
+   * @brief Transform Cartesian accelerations at the positions to Frenet
+   * accelerations.
+   *
+   * @param accCartes query accelerations in Cartesian coordinates.
+   * @param velFrenet velocities corresponding to accelerations in Frenet
+   * coordinates.
+   * @return PointsQueries result accelerations in Frenet coordinates.
+   */
+  PointsQueries accFrenet(const PointsQueries &accCartes,
+                          const PointsQueries &velFrenet) const {
+    return m_velTransformsInv.apply(accCartes - accInduced(velFrenet));
+  }
+
+  /**
+   * @brief Transform Cartesian accelerations at the positions to Frenet
+   * accelerations into caller-provided results.
+   *
+   * @param accCartes query accelerations in Cartesian coordinates.
+   * @param velFrenet velocities corresponding to accelerations in Frenet
+   * coordinates.
+   * @param result accelerations in Frenet coordinates.
+   */
+  void accFrenet(const PointsQueries &accCartes, const PointsQueries &velFrenet,
+                 PointsQueries &result) const {
+    evaluate(m_velTransformsInv.apply(accCartes - accInduced(velFrenet)),
+             result);
+  }
+
+private:
+  template <int, typename> friend class Transform;
+
+  PointsQueries m_posFrenet{};           /**<< bound Frenet positions */
+  Frames<NumQueries, Scalar> m_frames{}; /**<< path properties at positions */
+  // transformation matrices from Frenet to Cartesian velocities
+  Internal::Matrices2<NumQueries, Scalar> m_velTransforms{};
+  // transformation matrices from Cartesian to Frenet velocities
+  Internal::Matrices2<NumQueries, Scalar> m_velTransformsInv{};
+  // normal scale of squared longitudinal velocities in induced accelerations
+  ArrayQueries m_normalScales{};
+  // tangential scale of squared longitudinal velocities in induced
+  // accelerations
+  ArrayQueries m_tangentScales{};
+
+  /**
+   * @brief Cartesian accelerations induced by Frenet velocities at the
+   * positions. Equals the transformations to velocity-induced accelerations
+   * applied to the velocities, with the terms depending on the positions
+   * only precomputed.
+   *
+   * @param velFrenet velocities in Frenet coordinates.
+   * @return PointsExpression of the induced accelerations, referencing the
+   * velocities.
+   */
+  auto accInduced(const PointsQueries &velFrenet) const {
+    const auto &velLon{velFrenet.x()};
+    const auto &velLat{velFrenet.y()};
+    const auto &tangents{m_frames.tangents};
+    const auto &normals{m_frames.normals};
+    const auto &curvs{m_frames.curvatures};
+    const auto tangentScales{m_tangentScales * velLon.square() +
+                             2 * curvs * velLon * velLat};
+    return Internal::pointsExpression<BasicPoint<Scalar>>(
+        normals.x() * m_normalScales * velLon.square() -
+            tangents.x() * tangentScales,
+        normals.y() * m_normalScales * velLon.square() -
+            tangents.y() * tangentScales);
+  }
+
+  /**
+   * @brief Evaluate a point sequence into the existing storage of "result".
+   *
+   * @tparam Derived type of the point sequence.
+   * @param points point sequence to evaluate.
+   * @param result evaluated points.
+   */
+  template <typename Derived>
+  static void evaluate(const PointsBase<Derived, BasicPoint<Scalar>> &points,
+                       PointsQueries &result) {
+    result.x() = points.derived().x();
+    result.y() = points.derived().y();
+  }
+};
+}; // namespace FrenetTransform
+
+#endif
@@ -0,0 +1,57 @@
+#ifndef FRAMES_H
+#define FRAMES_H
+
+#include <Eigen/Core>
+
+#include "frenetTransform/point.h"
+#include "frenetTransform/points.h"
+
+namespace FrenetTransform {
+/**
+ * @brief Path properties provided by Frames, combined as bit mask.
+ *
+ */
+enum FrameProperty : unsigned int {
+  FramePoints = 1 << 0,         /**<< points along the path */
+  FrameTangents = 1 << 1,       /**<< tangent and normal vectors */
+  FrameCurvatures = 1 << 2,     /**<< path curvatures */
+  FrameCurvatureRates = 1 << 3, /**<< path curvature derivatives */
+  FrameAll = (1 << 4) - 1,      /**<< all path properties */
+};
+
+/**
+ * @brief Frenet frames along a path at query lengths.
+ * Bundles the path properties evaluated in a single pass. Properties not
+ * requested by the FrameProperty mask remain empty.
+ *
+ * @tparam NumQueries number of query points with -1 for dynamic point number.
+ * @tparam Scalar floating point type of the properties.
+ */
+template <int NumQueries = Eigen::Dynamic, typename Scalar = double>
+struct Frames {
+  using ArrayQueries = Eigen::Array<Scalar, NumQueries, 1>;
+  using PointsQueries = Points<NumQueries, BasicPoint<Scalar>>;
+
+  PointsQueries points{};        /**<< points along the path */
+  PointsQueries tangents{};      /**<< tangent vectors */
+  PointsQueries normals{};       /**<< normal vectors */
+  ArrayQueries curvatures{};     /**<< path curvatures */
+  ArrayQueries curvatureRates{}; /**<< path curvature derivatives */
+};
+
+/**
+ * @brief Frenet frame along a path at a single query length.
+ * Properties not requested by the FrameProperty mask remain zero.
+ *
+ * @tparam Scalar floating point type of the properties.
+ */
+template <typename Scalar = double> struct Frame {
+  BasicPoint<Scalar> point{};   /**<< point along the path */
+  BasicPoint<Scalar> tangent{}; /**<< tangent vector */
+  BasicPoint<Scalar> normal{};  /**<< normal vector */
+  Scalar curvature{};           /**<< path curvature */
+  Scalar curvatureRate{};       /**<< path curvature derivative */
+};
+}; // namespace FrenetTransform
+
+#endif
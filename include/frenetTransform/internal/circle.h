@@ -2,8 +2,10 @@
 #define CIRCLE_H
 
 #include <Eigen/Core>
+#include <cmath>
 #include <math.h>
 
+#include "frenetTransform/frames.h"
 #include "frenetTransform/internal/math.h"
 #include "frenetTransform/path.h"
 #include "frenetTransform/point.h"
@@ -11,9 +13,11 @@
 namespace FrenetTransform {
 namespace Internal {
 template <int NumQueries = Eigen::Dynamic>
-class Circle : public Path<NumQueries> {
+class Circle final : public Path<NumQueries> {
 public:
   using ArrayQueries = Eigen::Array<double, NumQueries, 1>;
+  using Path<NumQueries>::length;
+  using Path<NumQueries>::lengths;
 
   Circle() = delete;
 
@@ -31,6 +35,38 @@ public:
     return m_radius * (angleDir(dirsx, dirsy) - m_angle0);
   }
 
+  double length(const Point &point) const override {
+    return m_radius * (angleDir(point.x() - m_center.x(),
+                                point.y() - m_center.y()) -
+                       m_angle0);
+  }
+
+  Frame<double> frame(double length,
+                      unsigned int properties = FrameAll) const override {
+    const double angle{length / m_radius + m_angle0};
+    const double cos{std::cos(angle)};
+    const double sin{std::sin(angle)};
+    const Point grad1{-sin, cos};
+    const Point grad2{-cos / m_radius, -sin / m_radius};
+    const Point grad3{sin / std::pow(m_radius, 2),
+                      -cos / std::pow(m_radius, 2)};
+
+    Frame<double> result{};
+    if (properties & FramePoints)
+      result.point = {m_center.x() + m_radius * cos,
+                      m_center.y() + m_radius * sin};
+    if (properties & FrameTangents) {
+      result.tangent = grad1;
+      result.normal = {-grad1.y(), grad1.x()};
+    }
+    if (properties & FrameCurvatures)
+      result.curvature = Path<NumQueries>::curvature(grad1, grad2);
+    if (properties & FrameCurvatureRates)
+      result.curvatureRate =
+          Path<NumQueries>::curvatureRate(grad1, grad2, grad3);
+    return result;
+  }
+
   ArrayQueries lengths(const ArrayQueries &angles) const {
     return angles * m_radius;
   }
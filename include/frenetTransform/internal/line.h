@@ -2,8 +2,10 @@
 #define LINE_H
 
 #include <Eigen/Core>
+#include <algorithm>
 #include <math.h>
 
+#include "frenetTransform/frames.h"
 #include "frenetTransform/internal/math.h"
 #include "frenetTransform/path.h"
 #include "frenetTransform/point.h"
@@ -11,9 +13,11 @@
 namespace FrenetTransform {
 namespace Internal {
 template <int NumQueries = Eigen::Dynamic>
-class Line : public Path<NumQueries> {
+class Line final : public Path<NumQueries> {
 public:
   using ArrayQueries = Eigen::Array<double, NumQueries, 1>;
+  using Path<NumQueries>::length;
+  using Path<NumQueries>::lengths;
 
   Line() = delete;
 
@@ -45,16 +49,44 @@ public:
     return relLengths * m_end.distance(m_start);
   }
 
+  double length(const Point &point) const override {
+    const Point pointDiff{m_end - m_start};
+    const double relLength{std::clamp(
+        ((m_end.x() - point.x()) * pointDiff.x() +
+         (m_end.y() - point.y()) * pointDiff.y()) /
+            (std::pow(pointDiff.x(), 2) + std::pow(pointDiff.y(), 2)),
+        0.0, 1.0)};
+    return relLength * m_end.distance(m_start);
+  }
+
+  Frame<double> frame(double length,
+                      unsigned int properties = FrameAll) const override {
+    const double lineLength{m_end.distance(m_start)};
+    const double relLength{std::clamp(length / lineLength, 0.0, 1.0)};
+
+    Frame<double> result{};
+    if (properties & FramePoints)
+      result.point = {m_start.x() * relLength + (1 - relLength) * m_end.x(),
+                      m_start.y() * relLength + (1 - relLength) * m_end.y()};
+    if (properties & FrameTangents) {
+      result.tangent = {(m_start.x() - m_end.x()) / lineLength,
+                        (m_start.y() - m_end.y()) / lineLength};
+      result.normal = {-result.tangent.y(), result.tangent.x()};
+    }
+    return result;
+  }
+
 private:
   const Point m_start;
   const Point m_end;
 
   Points<NumQueries> gradient1(const ArrayQueries &lengths) const override {
-    ArrayQueries gradX(lengths.rows());
-    gradX += m_end.x() - m_start.x() / m_end.distance(m_start);
-    ArrayQueries gradY(lengths.rows());
-    gradY += m_end.y() - m_start.y() / m_end.distance(m_start);
-    return {gradX, gradY};
+    // points move from the end towards the start with increasing lengths
+    const double lineLength{m_end.distance(m_start)};
+    return {ArrayQueries::Constant(lengths.rows(),
+                                   (m_start.x() - m_end.x()) / lineLength),
+            ArrayQueries::Constant(lengths.rows(),
+                                   (m_start.y() - m_end.y()) / lineLength)};
   }
 
   Points<NumQueries> gradient2(const ArrayQueries &lengths) const override {
@@ -2,9 +2,14 @@
 #define MATH_H
 
 #include <Eigen/Core>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <concepts>
 
 namespace FrenetTransform {
-template <int NumRows> using ArrayRows = Eigen::Array<double, NumRows, 1>;
+template <int NumRows, typename Scalar = double>
+using ArrayRows = Eigen::Array<Scalar, NumRows, 1>;
 
 /**
  * @brief Perform row-wise backward differences on the input array.
@@ -67,14 +72,16 @@ ArrayType diffForward(const Eigen::ArrayBase<ArrayType> &numbers) {
  * @brief Provide cumulative lengths input given points.
  *
  * @tparam NumPoints row of input vector.
+ * @tparam Scalar floating point type of the coordinates.
  * @param x coordinates in x-direction.
  * @param y coordinates in y-direction.
- * @return ArrayRows<NumPoints> cumulative lengths input given points.
+ * @return ArrayRows<NumPoints, Scalar> cumulative lengths input given points.
  */
-template <int NumPoints>
-ArrayRows<NumPoints> partialLength(const ArrayRows<NumPoints> &x,
-                                   const ArrayRows<NumPoints> &y) {
-  ArrayRows<NumPoints> result{
+template <int NumPoints, typename Scalar = double>
+ArrayRows<NumPoints, Scalar>
+partialLength(const ArrayRows<NumPoints, Scalar> &x,
+              const ArrayRows<NumPoints, Scalar> &y) {
+  ArrayRows<NumPoints, Scalar> result{
       FrenetTransform::diffBackward(x).pow(2) +
       FrenetTransform::diffBackward(y).pow(2)}; // sum of squared distances
   result = result.sqrt(); // determine root of sum of squared distances
@@ -106,26 +113,71 @@ int first(const Eigen::ArrayBase<ArrayType> &sequence) {
   return index - 1;
 }
 
+/**
+ * @brief Provide index of first element not less than "value" in an ascending
+ * sequence. Equivalent to "first(sequence - value)" without allocating the
+ * shifted sequence. Gallops from "start" in doubling steps and bisects the
+ * enclosed range, such that ascending values resolve in a single walk over the
+ * sequence when passing the previous index as "start".
+ *
+ * @tparam ArrayType rows of input vector.
+ * @param sequence ascending input to search.
+ * @param value to compare the elements with.
+ * @param start index to search from, all elements before are less than
+ * "value".
+ * @return int index of first element not less than "value". Last index if no
+ * element is greater or equal.
+ */
+template <typename ArrayType>
+int firstSorted(const Eigen::ArrayBase<ArrayType> &sequence,
+                typename ArrayType::Scalar value, int start = 0) {
+  const int size{static_cast<int>(sequence.size())}; // number of elements
+
+  // candidates range from "lower" to element "upper" not less than "value"
+  int lower{std::max(start, 0)};
+  int upper{lower};
+
+  // gallop until an element not less than "value" is enclosed
+  for (int step{1}; upper < size && !(sequence(upper) - value >= 0);
+       step *= 2) {
+    lower = upper + 1;
+    upper += step;
+  }
+  upper = std::min(upper, size);
+
+  // bisect the enclosed range
+  while (lower < upper) {
+    const int middle{lower + (upper - lower) / 2};
+    if (sequence(middle) - value >= 0)
+      upper = middle;
+    else
+      lower = middle + 1;
+  }
+
+  return lower < size ? lower : lower - 1;
+}
+
 /**
  * @brief Determine gradient from finite differences.
  *
  * @tparam NumRows number of samples.
  * @tparam NumCols number of dependent variables.
+ * @tparam Scalar floating point type of the variables.
  * @param depents dependent variables.
  * @param indepents independent variables.
- * @return Eigen::Array<double, NumRows, NumCols> finite difference gradient.
+ * @return Eigen::Array<Scalar, NumRows, NumCols> finite difference gradient.
  */
-template <int NumRows, int NumCols>
-Eigen::Array<double, NumRows, NumCols>
-gradient(const Eigen::Array<double, NumRows, NumCols> &depents,
-         const Eigen::Array<double, NumRows, 1> &indepents) {
-  const Eigen::Array<double, NumRows, NumCols> diffDepents{
+template <int NumRows, int NumCols, typename Scalar = double>
+Eigen::Array<Scalar, NumRows, NumCols>
+gradient(const Eigen::Array<Scalar, NumRows, NumCols> &depents,
+         const Eigen::Array<Scalar, NumRows, 1> &indepents) {
+  const Eigen::Array<Scalar, NumRows, NumCols> diffDepents{
       diffBackward(depents)}; // finite differences dependent variables
-  const Eigen::Array<double, NumRows, 1> diffIndepents{
+  const Eigen::Array<Scalar, NumRows, 1> diffIndepents{
       diffBackward(indepents)}; // finite differences independent variables
 
-  Eigen::Array<double, NumRows, NumCols> result{
-      Eigen::Array<double, NumRows, NumCols>::Zero(
+  Eigen::Array<Scalar, NumRows, NumCols> result{
+      Eigen::Array<Scalar, NumRows, NumCols>::Zero(
           depents.rows(), depents.cols())}; // instantiate result array
 
   // perform column-wise normalization of dependent differences
@@ -142,6 +194,28 @@ gradient(const Eigen::Array<double, NumRows, NumCols> &depents,
   return result;
 }
 
+/**
+ * @brief Determines the angle of a single vector in range -pi to pi
+ *
+ * @tparam Scalar floating point type of the vector.
+ * @param dirx vector component in x-direction.
+ * @param diry vector component in y-direction.
+ * @return Scalar angle of the vector.
+ */
+template <std::floating_point Scalar>
+Scalar angleDir(Scalar dirx, Scalar diry) {
+  constexpr Scalar pi{static_cast<Scalar>(M_PI)};
+  if (dirx > 0 && dirx > std::abs(diry))
+    return std::atan(diry / dirx);
+  if (diry > 0 && std::abs(dirx) < diry)
+    return pi / 2 - std::atan(dirx / diry);
+  if (dirx < 0 && diry > 0 && -dirx > diry)
+    return pi + std::atan(diry / dirx);
+  if (diry < 0 && std::abs(dirx) < -diry)
+    return -pi / 2 - std::atan(dirx / diry);
+  return -pi + std::atan(diry / dirx);
+}
+
 /**
  * @brief Determines angles of given vector in range -pi to pi
  *
@@ -156,43 +230,56 @@ ArrayType angleDir(const Eigen::ArrayBase<ArrayType> &dirxs,
   ArrayType angles{
       Eigen::ArrayBase<ArrayType>::Zero(dirxs.rows(), dirxs.cols())};
 
-  for (int row{}; row < dirxs.rows(); ++row) {
-    for (int col{}; col < dirxs.cols(); ++col) {
-      if (dirxs(row, col) > 0 && dirxs(row, col) > std::abs(dirys(row, col)))
-        angles(row, col) = std::atan(dirys(row, col) / dirxs(row, col));
-      else if (dirys(row, col) > 0 &&
-               std::abs(dirxs(row, col)) < dirys(row, col))
-        angles(row, col) =
-            M_PI / 2 - std::atan(dirxs(row, col) / dirys(row, col));
-      else if (dirxs(row, col) < 0 && dirys(row, col) > 0 &&
-               -dirxs(row, col) > dirys(row, col))
-        angles(row, col) = M_PI + std::atan(dirys(row, col) / dirxs(row, col));
-      else if (dirys(row, col) < 0 &&
-               std::abs(dirxs(row, col)) < -dirys(row, col))
-        angles(row, col) =
-            -M_PI / 2 - std::atan(dirxs(row, col) / dirys(row, col));
-      else
-        angles(row, col) = -M_PI + std::atan(dirys(row, col) / dirxs(row, col));
-    }
-  }
+  for (int row{}; row < dirxs.rows(); ++row)
+    for (int col{}; col < dirxs.cols(); ++col)
+      angles(row, col) = angleDir(dirxs(row, col), dirys(row, col));
 
   return angles;
 }
 
 /**
- * @brief Inverts "NumArrays" 2x2 arrays.
+ * @brief Nodes of the 5-point Gauss-Legendre quadrature on the interval from
+ * -1 to 1.
+ *
+ */
+inline constexpr std::array<double, 5> gaussNodes{
+    0.0, -0.5384693101056831, 0.5384693101056831, -0.9061798459386640,
+    0.9061798459386640};
+
+/**
+ * @brief Weights of the 5-point Gauss-Legendre quadrature at "gaussNodes".
  *
- * @tparam NumArrays number of input arrays.
- * @param arrays to invert.
- * @return Eigen::Array<ArrayRows<NumArrays>, 2, 2> inverted arrays.
  */
-template <int NumArrays>
-Eigen::Array<ArrayRows<NumArrays>, 2, 2>
-transformInv(const Eigen::Array<ArrayRows<NumArrays>, 2, 2> &arrays) {
-  const auto normalization{
-      1 / (arrays(0, 0) * arrays(1, 1) - arrays(1, 0) * arrays(0, 1))};
-  return {{arrays(1, 1) * normalization, -arrays(0, 1) * normalization},
-          {-arrays(1, 0) * normalization, arrays(0, 0) * normalization}};
+inline constexpr std::array<double, 5> gaussWeights{
+    0.5688888888888889, 0.4786286704993665, 0.4786286704993665,
+    0.2369268850561891, 0.2369268850561891};
+
+/**
+ * @brief Determines the generalized Fresnel integrals of a clothoid arc,
+ * which are the displacements along the arc in x- and y-direction.
+ * Integrates the unit tangent with 5-point Gauss-Legendre quadrature. Exact to
+ * rounding if the heading changes by less than a quarter radian along the
+ * arc, thus longer arcs must be split before.
+ *
+ * @tparam Scalar floating point type of the arc and displacements.
+ * @param heading tangent angle at the arc start.
+ * @param curvature curvature at the arc start.
+ * @param sharpness curvature derivative by arc length.
+ * @param length arc length.
+ * @return std::array<Scalar, 2> displacements in x- and y-direction.
+ */
+template <std::floating_point Scalar>
+std::array<Scalar, 2> fresnel(Scalar heading, Scalar curvature,
+                              Scalar sharpness, Scalar length) {
+  std::array<Scalar, 2> result{};
+  for (std::size_t node{}; node < gaussNodes.size(); ++node) {
+    const Scalar part{length * (1 + static_cast<Scalar>(gaussNodes[node])) /
+                      2};
+    const Scalar angle{heading + part * (curvature + part * sharpness / 2)};
+    result[0] += static_cast<Scalar>(gaussWeights[node]) * std::cos(angle);
+    result[1] += static_cast<Scalar>(gaussWeights[node]) * std::sin(angle);
+  }
+  return {result[0] * length / 2, result[1] * length / 2};
 }
 }; // namespace FrenetTransform
 
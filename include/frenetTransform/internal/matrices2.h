@@ -0,0 +1,186 @@
+#ifndef MATRICES2_H
+#define MATRICES2_H
+
+#include <Eigen/Core>
+#include <utility>
+
+#include "frenetTransform/points.h"
+
+namespace FrenetTransform {
+namespace Internal {
+/**
+ * @brief Batch of 2x2 matrices stored as structure of arrays.
+ * Each coefficient is a contiguous column of a single array, such that the
+ * batched kernels vectorize over the matrices and the whole batch needs one
+ * allocation at most.
+ *
+ * @tparam NumMatrices number of matrices with -1 for dynamic matrix number.
+ * @tparam Scalar floating point type of the coefficients.
+ */
+template <int NumMatrices = Eigen::Dynamic, typename Scalar = double>
+class Matrices2 {
+public:
+  using ArrayMatrices = Eigen::Array<Scalar, NumMatrices, 1>;
+
+  Matrices2() = default;
+
+  /**
+   * @brief Construct a new Matrices2 object with "numMatrices" uninitialized
+   * matrices.
+   *
+   * @param numMatrices number of matrices.
+   */
+  explicit Matrices2(int numMatrices) { resize(numMatrices); }
+
+  /**
+   * @brief Resize the batch. Coefficients are uninitialized if the number of
+   * matrices changes and kept otherwise without reallocation.
+   *
+   * @param numMatrices new number of matrices.
+   */
+  void resize(int numMatrices) { m_coeffs.resize(numMatrices, 4); }
+
+  /**
+   * @brief Provide the number of matrices in the batch.
+   *
+   * @return int number of matrices.
+   */
+  int numMatrices() const { return static_cast<int>(m_coeffs.rows()); }
+
+  /**
+   * @brief Get the coefficients at "row" and "col" of all matrices.
+   *
+   * @param row of the coefficients.
+   * @param col of the coefficients.
+   * @return modifiable column of coefficients.
+   */
+  auto operator()(int row, int col) { return m_coeffs.col(2 * row + col); }
+
+  /**
+   * @brief Get the coefficients at "row" and "col" of all matrices.
+   *
+   * @param row of the coefficients.
+   * @param col of the coefficients.
+   * @return column of coefficients.
+   */
+  auto operator()(int row, int col) const {
+    return m_coeffs.col(2 * row + col);
+  }
+
+  /**
+   * @brief Determinants of all matrices.
+   *
+   * @return Eigen expression of the determinants.
+   */
+  auto determinants() const {
+    return (*this)(0, 0) * (*this)(1, 1) - (*this)(1, 0) * (*this)(0, 1);
+  }
+
+  /**
+   * @brief Multiply each matrix with its vector.
+   *
+   * @tparam Vectors type of the vector sequence.
+   * @param vectors one vector per matrix.
+   * @return PointsExpression with the products, referencing the matrices.
+   */
+  template <PointsSequence Vectors> auto apply(Vectors &&vectors) const {
+    return makeExpression<Product, PointTypeOf<Vectors>>(
+        *this, std::forward<Vectors>(vectors));
+  }
+
+  /**
+   * @brief Solve each matrix's linear system for its right-hand side by
+   * Cramer's rule, without forming the inverse matrices. A single pass
+   * evaluates each right-hand side and determinant once.
+   *
+   * @tparam Derived type of the right-hand side sequence.
+   * @tparam PointType type of points.
+   * @param vectors one right-hand side per matrix.
+   * @param result solutions, resized to the number of matrices.
+   */
+  template <typename Derived, typename PointType>
+  void inverseApply(const PointsBase<Derived, PointType> &vectors,
+                    Points<NumMatrices, PointType> &result) const {
+    const auto &x{vectors.derived().x()};
+    const auto &y{vectors.derived().y()};
+    const auto coeffs00{(*this)(0, 0)};
+    const auto coeffs01{(*this)(0, 1)};
+    const auto coeffs10{(*this)(1, 0)};
+    const auto coeffs11{(*this)(1, 1)};
+    const int numMatrices{this->numMatrices()};
+    result.resize(numMatrices);
+    auto &resultX{result.x()};
+    auto &resultY{result.y()};
+    for (int index{}; index < numMatrices; ++index) {
+      const Scalar rhsX{x(index)};
+      const Scalar rhsY{y(index)};
+      const Scalar determinant{coeffs00(index) * coeffs11(index) -
+                               coeffs10(index) * coeffs01(index)};
+      resultX(index) =
+          (coeffs11(index) * rhsX - coeffs01(index) * rhsY) / determinant;
+      resultY(index) =
+          (coeffs00(index) * rhsY - coeffs10(index) * rhsX) / determinant;
+    }
+  }
+
+  /**
+   * @brief Invert each matrix in a single pass.
+   *
+   * @param result inverse matrices, resized to the number of matrices. Must
+   * not alias the matrices.
+   */
+  void inverse(Matrices2 &result) const {
+    const int numMatrices{this->numMatrices()};
+    result.resize(numMatrices);
+    for (int index{}; index < numMatrices; ++index) {
+      const Scalar coeff00{m_coeffs(index, 0)};
+      const Scalar coeff01{m_coeffs(index, 1)};
+      const Scalar coeff10{m_coeffs(index, 2)};
+      const Scalar coeff11{m_coeffs(index, 3)};
+      const Scalar determinant{coeff00 * coeff11 - coeff10 * coeff01};
+      result.m_coeffs(index, 0) = coeff11 / determinant;
+      result.m_coeffs(index, 1) = -coeff01 / determinant;
+      result.m_coeffs(index, 2) = -coeff10 / determinant;
+      result.m_coeffs(index, 3) = coeff00 / determinant;
+    }
+  }
+
+  /**
+   * @brief Multiply each matrix with the matrix of "rhs" from the right.
+   *
+   * @param rhs right-hand side matrices, one per matrix.
+   * @param result products, resized to the number of matrices. Must not alias
+   * the factors.
+   */
+  void multiply(const Matrices2 &rhs, Matrices2 &result) const {
+    result.resize(numMatrices());
+    for (int row{}; row < 2; ++row)
+      for (int col{}; col < 2; ++col)
+        result(row, col) =
+            (*this)(row, 0) * rhs(0, col) + (*this)(row, 1) * rhs(1, col);
+  }
+
+private:
+  /**
+   * @brief Operation multiplying matrices with vectors.
+   *
+   */
+  struct Product {
+    template <typename Vectors>
+    static auto x(const Matrices2 &matrices, const Vectors &vectors) {
+      return matrices(0, 0) * vectors.x() + matrices(0, 1) * vectors.y();
+    }
+
+    template <typename Vectors>
+    static auto y(const Matrices2 &matrices, const Vectors &vectors) {
+      return matrices(1, 0) * vectors.x() + matrices(1, 1) * vectors.y();
+    }
+  };
+
+  // coefficients (0, 0), (0, 1), (1, 0) and (1, 1) of all matrices
+  Eigen::Array<Scalar, NumMatrices, 4> m_coeffs{};
+};
+}; // namespace Internal
+}; // namespace FrenetTransform
+
+#endif
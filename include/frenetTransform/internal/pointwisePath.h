@@ -0,0 +1,238 @@
+#ifndef POINTWISE_PATH_H
+#define POINTWISE_PATH_H
+
+#include <Eigen/Core>
+
+#include "frenetTransform/frames.h"
+#include "frenetTransform/path.h"
+#include "frenetTransform/point.h"
+#include "frenetTransform/points.h"
+
+namespace FrenetTransform {
+namespace Internal {
+/**
+ * @brief Path base class for paths evaluated one query at a time.
+ * Derived paths provide the frame at a single length and the next point to a
+ * single query point. The queries of the array interface loop over those
+ * without allocation if the sizes of the results match the queries.
+ *
+ * The gradients by arc length follow from the unit tangent, the curvature and
+ * the curvature derivative of the frames with the Frenet-Serret formulas.
+ * Derived paths keep their geometry and projection in double precision for
+ * any Scalar of the queries.
+ *
+ * @tparam NumQueries number of query points with -1 for dynamic point number.
+ * @tparam Scalar floating point type of the query points and properties.
+ */
+template <int NumQueries = Eigen::Dynamic, typename Scalar = double>
+class PointwisePath : public Path<NumQueries, Scalar> {
+public:
+  using ArrayQueries = Eigen::Array<Scalar, NumQueries, 1>;
+  using PointsQueries = Points<NumQueries, BasicPoint<Scalar>>;
+
+  /**
+   * @brief Gets points along the path at the query lengths.
+   *
+   * @param lengths query lengths along the path.
+   * @return PointsQueries at the query lengths.
+   */
+  PointsQueries operator()(const ArrayQueries &lengths) const final {
+    PointsQueries result{};
+    result.resize(lengths.rows());
+    for (int row{}; row < lengths.rows(); ++row) {
+      const BasicPoint<Scalar> point{
+          this->frame(lengths(row), FramePoints).point};
+      result.x()(row) = point.x();
+      result.y()(row) = point.y();
+    }
+    return result;
+  }
+
+  /**
+   * @brief Determines the Frenet frames at the given path lengths in a single
+   * pass. Evaluates each length only once for all requested properties.
+   *
+   * @param lengths lengths along the path.
+   * @param properties mask of FrameProperty values to determine.
+   * @return Frames<NumQueries, Scalar> frames with the requested properties.
+   */
+  Frames<NumQueries, Scalar>
+  frames(const ArrayQueries &lengths,
+         unsigned int properties = FrameAll) const final {
+    Frames<NumQueries, Scalar> result{};
+    frames(lengths, properties, result);
+    return result;
+  }
+
+  /**
+   * @brief Determines the Frenet frames at the given path lengths into
+   * caller-provided frames without allocation if their sizes match the
+   * lengths. Properties not requested remain unchanged.
+   *
+   * @param lengths lengths along the path.
+   * @param properties mask of FrameProperty values to determine.
+   * @param result frames with the requested properties.
+   */
+  void frames(const ArrayQueries &lengths, unsigned int properties,
+              Frames<NumQueries, Scalar> &result) const final {
+    const int numQueries{static_cast<int>(lengths.rows())};
+    if (properties & FramePoints)
+      result.points.resize(numQueries);
+    if (properties & FrameTangents) {
+      result.tangents.resize(numQueries);
+      result.normals.resize(numQueries);
+    }
+    if (properties & FrameCurvatures)
+      result.curvatures.resize(numQueries);
+    if (properties & FrameCurvatureRates)
+      result.curvatureRates.resize(numQueries);
+
+    for (int row{}; row < numQueries; ++row) {
+      const Frame<Scalar> frame{this->frame(lengths(row), properties)};
+      if (properties & FramePoints) {
+        result.points.x()(row) = frame.point.x();
+        result.points.y()(row) = frame.point.y();
+      }
+      if (properties & FrameTangents) {
+        result.tangents.x()(row) = frame.tangent.x();
+        result.tangents.y()(row) = frame.tangent.y();
+        result.normals.x()(row) = frame.normal.x();
+        result.normals.y()(row) = frame.normal.y();
+      }
+      if (properties & FrameCurvatures)
+        result.curvatures(row) = frame.curvature;
+      if (properties & FrameCurvatureRates)
+        result.curvatureRates(row) = frame.curvatureRate;
+    }
+  }
+
+  /**
+   * @brief Determines next points to the query points.
+   *
+   * @param points query points.
+   * @return ArrayQueries lengths next to query points.
+   */
+  ArrayQueries lengths(const PointsQueries &points) const final {
+    ArrayQueries result{};
+    lengths(points, result);
+    return result;
+  }
+
+  /**
+   * @brief Determines next points to the query points into caller-provided
+   * lengths without allocation if their size matches the query points.
+   *
+   * @param points query points.
+   * @param result lengths next to query points.
+   */
+  void lengths(const PointsQueries &points,
+               ArrayQueries &result) const final {
+    result.resize(points.numPoints());
+    for (int cQuery{}; cQuery < points.numPoints(); ++cQuery)
+      result(cQuery) = this->length(points(cQuery));
+  }
+
+  /**
+   * @brief Determines next points to the query points close to previous
+   * lengths.
+   *
+   * @param points query points.
+   * @param hints previous lengths along the path for each query point.
+   * @param window maximum length difference to the hints searched locally.
+   * @return ArrayQueries lengths next to query points.
+   */
+  ArrayQueries lengths(const PointsQueries &points, const ArrayQueries &hints,
+                       Scalar window) const final {
+    ArrayQueries result{};
+    lengths(points, hints, window, result);
+    return result;
+  }
+
+  /**
+   * @brief Determines next points to the query points close to previous
+   * lengths into caller-provided lengths without allocation if their size
+   * matches the query points.
+   *
+   * @param points query points.
+   * @param hints previous lengths along the path for each query point.
+   * @param window maximum length difference to the hints searched locally.
+   * @param result lengths next to query points.
+   */
+  void lengths(const PointsQueries &points, const ArrayQueries &hints,
+               Scalar window, ArrayQueries &result) const final {
+    result.resize(points.numPoints());
+    for (int cQuery{}; cQuery < points.numPoints(); ++cQuery)
+      result(cQuery) = this->length(points(cQuery), hints(cQuery), window);
+  }
+
+private:
+  /**
+   * @brief Determines 1st order gradient at the given path lengths, which is
+   * the unit tangent.
+   *
+   * @param lengths lengths along the path.
+   * @return 1st order gradient at given path lengths.
+   */
+  PointsQueries gradient1(const ArrayQueries &lengths) const final {
+    return gradientsAt(1, lengths);
+  }
+
+  /**
+   * @brief Determines 2nd order gradient at the given path lengths.
+   *
+   * @param lengths lengths along the path.
+   * @return 2nd order gradient at given path lengths.
+   */
+  PointsQueries gradient2(const ArrayQueries &lengths) const final {
+    return gradientsAt(2, lengths);
+  }
+
+  /**
+   * @brief Determines 3rd order gradient at the given path lengths.
+   *
+   * @param lengths lengths along the path.
+   * @return 3rd order gradient at given path lengths.
+   */
+  PointsQueries gradient3(const ArrayQueries &lengths) const final {
+    return gradientsAt(3, lengths);
+  }
+
+  /**
+   * @brief Determines the gradients of the given order at the given path
+   * lengths from the frames at the lengths.
+   *
+   * @param order order of the gradient from one to three.
+   * @param lengths lengths along the path.
+   * @return gradients of the given order at the path lengths.
+   */
+  PointsQueries gradientsAt(int order, const ArrayQueries &lengths) const {
+    const unsigned int properties{
+        order == 1   ? FrameTangents
+        : order == 2 ? FrameTangents | FrameCurvatures
+                     : FrameTangents | FrameCurvatures | FrameCurvatureRates};
+
+    PointsQueries result{};
+    result.resize(lengths.rows());
+    for (int row{}; row < lengths.rows(); ++row) {
+      const Frame<Scalar> frame{this->frame(lengths(row), properties)};
+      const BasicPoint<Scalar> &tangent{frame.tangent};
+      const BasicPoint<Scalar> &normal{frame.normal};
+      const Scalar curv{frame.curvature};
+
+      // derivatives of the unit tangent by arc length
+      BasicPoint<Scalar> grad{tangent};
+      if (order == 2)
+        grad = {curv * normal.x(), curv * normal.y()};
+      else if (order == 3)
+        grad = {frame.curvatureRate * normal.x() - curv * curv * tangent.x(),
+                frame.curvatureRate * normal.y() - curv * curv * tangent.y()};
+      result.x()(row) = grad.x();
+      result.y()(row) = grad.y();
+    }
+    return result;
+  }
+};
+}; // namespace Internal
+}; // namespace FrenetTransform
+
+#endif
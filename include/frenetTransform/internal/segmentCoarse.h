@@ -0,0 +1,179 @@
+#ifndef SEGMENT_COARSE_H
+#define SEGMENT_COARSE_H
+
+#include <Eigen/Core>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "frenetTransform/point.h"
+
+namespace FrenetTransform {
+namespace Internal {
+/**
+ * @brief Decimated level over the segments of a polychain.
+ * Keeps every "stride"-th point and the last point. Each coarse segment covers
+ * the fine segments between its points, which deviate at most by the coarse
+ * segment's radius. Fine segments are identified by the index of their end
+ * point, such that segment "cPoints" connects the points "cPoints - 1" and
+ * "cPoints".
+ *
+ */
+class SegmentCoarse {
+public:
+  SegmentCoarse() = default;
+
+  /**
+   * @brief Construct a new SegmentCoarse over the segments between consecutive
+   * points.
+   *
+   * @tparam ArrayType array type of coordinates.
+   * @param x coordinates in x-direction along the polychain.
+   * @param y coordinates in y-direction along the polychain.
+   * @param stride number of fine segments per coarse segment.
+   */
+  template <typename ArrayType>
+  SegmentCoarse(const Eigen::ArrayBase<ArrayType> &x,
+                const Eigen::ArrayBase<ArrayType> &y, int stride) {
+    const int numPoints{static_cast<int>(x.rows())};
+    if (numPoints < 2)
+      return;
+
+    // indices of points kept in the coarse level
+    for (int cPoints{}; cPoints < numPoints - 1;
+         cPoints += std::max(stride, 1))
+      m_indices.push_back(cPoints);
+    m_indices.push_back(numPoints - 1);
+
+    for (const int index : m_indices)
+      m_points.emplace_back(x(index), y(index));
+
+    // largest deviation of fine points from their coarse segment
+    m_radii.resize(m_indices.size() - 1);
+    for (std::size_t cCoarse{}; cCoarse < m_radii.size(); ++cCoarse) {
+      const int cEnd{m_indices[cCoarse + 1]};
+      for (int cPoints{m_indices[cCoarse] + 1}; cPoints < cEnd; ++cPoints)
+        m_radii[cCoarse] = std::max(
+            m_radii[cCoarse], distance(Point{x(cPoints), y(cPoints)},
+                                       m_points[cCoarse],
+                                       m_points[cCoarse + 1]));
+    }
+
+    m_coordinateMax = std::max(x.abs().maxCoeff(), y.abs().maxCoeff());
+  }
+
+  /**
+   * @brief Whether the coarse level contains no segments.
+   *
+   * @return true if no segments are stored.
+   */
+  bool empty() const { return m_radii.empty(); }
+
+  /**
+   * @brief Number of coarse segments.
+   *
+   * @return int number of coarse segments.
+   */
+  int size() const { return static_cast<int>(m_radii.size()); }
+
+  /**
+   * @brief Visits the fine segments that may be closer to "point" than the
+   * current minimum squared distance. First visits the coarse segment with
+   * the smallest upper distance bound, then all coarse segments whose lower
+   * distance bound does not exceed the current minimum.
+   *
+   * @tparam Visitor callable taking the first fine segment of a coarse
+   * segment and the one after its last, returning the updated minimum squared
+   * distance.
+   * @param point query point.
+   * @param visit evaluates the distance to a range of fine segments.
+   * @param distanceSquare initial minimum squared distance.
+   */
+  template <typename Visitor>
+  void nearest(const Point &point, Visitor &&visit,
+               double distanceSquare =
+                   std::numeric_limits<double>::infinity()) const {
+    if (empty())
+      return;
+
+    // coarse segment with the closest upper distance bound
+    std::size_t coarseBest{};
+    double upperBest{std::numeric_limits<double>::infinity()};
+    for (std::size_t cCoarse{}; cCoarse < m_radii.size(); ++cCoarse) {
+      const double upper{
+          distance(point, m_points[cCoarse], m_points[cCoarse + 1]) +
+          m_radii[cCoarse]};
+      if (upper < upperBest) {
+        upperBest = upper;
+        coarseBest = cCoarse;
+      }
+    }
+    distanceSquare = visitCoarse(coarseBest, visit);
+
+    // bound of rounding differences between coarse and fine distances
+    const double slack{
+        s_slack *
+        std::max({m_coordinateMax, std::abs(point.x()), std::abs(point.y())})};
+
+    for (std::size_t cCoarse{}; cCoarse < m_radii.size(); ++cCoarse) {
+      if (cCoarse == coarseBest)
+        continue;
+      const double lower{
+          distance(point, m_points[cCoarse], m_points[cCoarse + 1]) -
+          m_radii[cCoarse] - slack};
+      if (!(lower > std::sqrt(distanceSquare)))
+        distanceSquare = visitCoarse(cCoarse, visit);
+    }
+  }
+
+private:
+  static constexpr double s_slack{
+      64 * std::numeric_limits<double>::epsilon()}; /**<< relative slack */
+
+  std::vector<int> m_indices{};  /**<< indices of the coarse points */
+  std::vector<Point> m_points{}; /**<< coarse points */
+  std::vector<double> m_radii{}; /**<< deviations of fine from coarse */
+  double m_coordinateMax{};      /**<< maximum absolute coordinate */
+
+  /**
+   * @brief Visits the fine segments covered by coarse segment "cCoarse".
+   *
+   * @tparam Visitor callable taking a range of fine segments.
+   * @param cCoarse index of the coarse segment.
+   * @param visit evaluates the distance to a range of fine segments.
+   * @return double updated minimum squared distance.
+   */
+  template <typename Visitor>
+  double visitCoarse(std::size_t cCoarse, Visitor &&visit) const {
+    return visit(m_indices[cCoarse] + 1, m_indices[cCoarse + 1] + 1);
+  }
+
+  /**
+   * @brief Distance between "point" and the segment from "start" to "end".
+   *
+   * @param point query point.
+   * @param start point at the segment start.
+   * @param end point at the segment end.
+   * @return double distance to the segment.
+   */
+  static double distance(const Point &point, const Point &start,
+                         const Point &end) {
+    const Point direction{end - start};
+    const Point diff{point - start};
+    const double lengthSquare{direction.x() * direction.x() +
+                              direction.y() * direction.y()};
+    const double part{
+        lengthSquare > 0.0
+            ? std::clamp((diff.x() * direction.x() + diff.y() * direction.y()) /
+                             lengthSquare,
+                         0.0, 1.0)
+            : 0.0};
+    return point.distance(Point{start.x() + part * direction.x(),
+                                start.y() + part * direction.y()});
+  }
+};
+}; // namespace Internal
+}; // namespace FrenetTransform
+
+#endif
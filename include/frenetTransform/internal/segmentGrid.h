@@ -0,0 +1,220 @@
+#ifndef SEGMENT_GRID_H
+#define SEGMENT_GRID_H
+
+#include <Eigen/Core>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "frenetTransform/internal/segmentTree.h"
+#include "frenetTransform/point.h"
+
+namespace FrenetTransform {
+namespace Internal {
+/**
+ * @brief Uniform grid over the segments of a polychain.
+ * Segments are identified by the index of their end point, such that segment
+ * "cPoints" connects the points "cPoints - 1" and "cPoints". Each cell stores
+ * the segments whose bounding box overlaps the cell. Cells are stored in a
+ * flat array with row-major order.
+ *
+ */
+class SegmentGrid {
+public:
+  SegmentGrid() = default;
+
+  /**
+   * @brief Construct a new SegmentGrid over the segments between consecutive
+   * points. The cell size is enlarged if the grid would exceed
+   * "s_maxCellsSegment" cells per segment.
+   *
+   * @tparam ArrayType array type of coordinates.
+   * @param x coordinates in x-direction along the polychain.
+   * @param y coordinates in y-direction along the polychain.
+   * @param cellSize side length of the square grid cells.
+   */
+  template <typename ArrayType>
+  SegmentGrid(const Eigen::ArrayBase<ArrayType> &x,
+              const Eigen::ArrayBase<ArrayType> &y, double cellSize) {
+    const int numSegments{static_cast<int>(x.rows()) - 1};
+    if (numSegments < 1)
+      return;
+
+    // bounding box of all points
+    m_origin = {x.minCoeff(), y.minCoeff()};
+    const double width{x.maxCoeff() - m_origin.x()};
+    const double height{y.maxCoeff() - m_origin.y()};
+
+    // limit number of cells in total and along each axis
+    const double numCellsMax{s_maxCellsSegment * numSegments};
+    const double cellSizeMin{std::max(std::sqrt(width * height / numCellsMax),
+                                      std::max(width, height) / numCellsMax)};
+    m_cellSize = std::max({cellSize, cellSizeMin,
+                           std::numeric_limits<double>::min()});
+    m_numX = static_cast<int>(width / m_cellSize) + 1;
+    m_numY = static_cast<int>(height / m_cellSize) + 1;
+
+    // count segments per cell
+    m_cellBegin.assign(m_numX * m_numY + 1, 0);
+    for (int cPoints{1}; cPoints <= numSegments; ++cPoints)
+      forCells(x, y, cPoints, [this](int cell) { ++m_cellBegin[cell + 1]; });
+
+    // accumulate counts to offsets of each cell
+    for (int cell{}; cell < m_numX * m_numY; ++cell)
+      m_cellBegin[cell + 1] += m_cellBegin[cell];
+
+    // store segment indices per cell
+    m_segments.resize(m_cellBegin.back());
+    std::vector<int> cellEnd{m_cellBegin.begin(), m_cellBegin.end() - 1};
+    for (int cPoints{1}; cPoints <= numSegments; ++cPoints)
+      forCells(x, y, cPoints, [this, &cellEnd, cPoints](int cell) {
+        m_segments[cellEnd[cell]++] = cPoints;
+      });
+  }
+
+  /**
+   * @brief Whether the grid contains no segments.
+   *
+   * @return true if no segments are stored.
+   */
+  bool empty() const { return m_segments.empty(); }
+
+  /**
+   * @brief Provides the side length of the grid cells.
+   *
+   * @return double side length of the square grid cells.
+   */
+  double cellSize() const { return m_cellSize; }
+
+  /**
+   * @brief Visits the segments that may be closer to "point" than the current
+   * minimum squared distance. Cells are visited in rings of increasing distance
+   * around the cell containing "point" until the next ring is farther than the
+   * current minimum.
+   *
+   * @tparam Visitor callable taking a segment index and returning the updated
+   * minimum squared distance.
+   * @param point query point.
+   * @param visit evaluates the distance to a segment.
+   * @param distanceSquare initial minimum squared distance.
+   */
+  template <typename Visitor>
+  void nearest(const Point &point, Visitor &&visit,
+               double distanceSquare =
+                   std::numeric_limits<double>::infinity()) const {
+    if (m_segments.empty())
+      return;
+
+    // cell containing the query point, possibly outside the grid
+    const int cellX{cellIndex(point.x() - m_origin.x())};
+    const int cellY{cellIndex(point.y() - m_origin.y())};
+
+    // rings closer to the query point do not overlap the grid
+    const int ringMin{std::max({0, cellX - m_numX + 1, -cellX,
+                                cellY - m_numY + 1, -cellY})};
+    const int ringMax{std::max({cellX, m_numX - 1 - cellX, cellY,
+                                m_numY - 1 - cellY})};
+
+    // visit all segments in a cell
+    const auto visitCell{[this, &visit, &distanceSquare](int cx, int cy) {
+      const int cell{cy * m_numX + cx};
+      for (int cSegment{m_cellBegin[cell]}; cSegment < m_cellBegin[cell + 1];
+           ++cSegment)
+        distanceSquare = visit(m_segments[cSegment]);
+    }};
+
+    for (int ring{ringMin}; ring <= ringMax; ++ring) {
+      // visit cells at Chebyshev distance "ring" to the query cell
+      const int xBegin{std::max(cellX - ring, 0)};
+      const int xEnd{std::min(cellX + ring, m_numX - 1)};
+      const int yBegin{std::max(cellY - ring, 0)};
+      const int yEnd{std::min(cellY + ring, m_numY - 1)};
+      for (int cy{yBegin}; cy <= yEnd; ++cy) {
+        // complete rows at top and bottom of the ring
+        if (cy == cellY - ring || cy == cellY + ring) {
+          for (int cx{xBegin}; cx <= xEnd; ++cx)
+            visitCell(cx, cy);
+        }
+        // columns at left and right of the ring
+        else {
+          if (xBegin == cellX - ring)
+            visitCell(xBegin, cy);
+          if (xEnd == cellX + ring)
+            visitCell(xEnd, cy);
+        }
+      }
+
+      // distance between query point and cells beyond the current ring
+      const double gap{std::min(
+          {point.x() - m_origin.x() - (cellX - ring) * m_cellSize,
+           m_origin.x() + (cellX + ring + 1) * m_cellSize - point.x(),
+           point.y() - m_origin.y() - (cellY - ring) * m_cellSize,
+           m_origin.y() + (cellY + ring + 1) * m_cellSize - point.y()})};
+      if (gap > 0.0 && gap * gap > distanceSquare)
+        return;
+    }
+  }
+
+private:
+  static constexpr double s_maxCellsSegment{
+      4.0}; /**<< maximum number of cells per segment */
+
+  Point m_origin{};       /**<< lower corner of the grid */
+  double m_cellSize{1.0}; /**<< side length of the grid cells */
+  int m_numX{};           /**<< number of cells in x-direction */
+  int m_numY{};           /**<< number of cells in y-direction */
+
+  std::vector<int> m_cellBegin{}; /**<< offsets of each cell in m_segments */
+  std::vector<int> m_segments{};  /**<< segment indices ordered by cells */
+
+  /**
+   * @brief Provides the index of the cell containing the "offset" from the
+   * grid origin. Offsets outside the grid resolve to indices outside the grid.
+   *
+   * @param offset distance from the grid origin along one axis.
+   * @return int cell index along the axis.
+   */
+  int cellIndex(double offset) const {
+    constexpr double indexLimit{1 << 28};
+    return static_cast<int>(
+        std::floor(std::clamp(offset / m_cellSize, -indexLimit, indexLimit)));
+  }
+
+  /**
+   * @brief Invokes "apply" for each cell overlapped by the bounding box of
+   * segment "cPoints".
+   *
+   * @tparam ArrayType array type of coordinates.
+   * @tparam Function callable taking a cell index.
+   * @param x coordinates in x-direction along the polychain.
+   * @param y coordinates in y-direction along the polychain.
+   * @param cPoints index of the point at the segment end.
+   * @param apply invoked for each overlapped cell.
+   */
+  template <typename ArrayType, typename Function>
+  void forCells(const Eigen::ArrayBase<ArrayType> &x,
+                const Eigen::ArrayBase<ArrayType> &y, int cPoints,
+                Function &&apply) const {
+    Box box{};
+    box.extend(Point{x(cPoints - 1), y(cPoints - 1)});
+    box.extend(Point{x(cPoints), y(cPoints)});
+
+    const int xBegin{std::clamp(cellIndex(box.xMin - m_origin.x()), 0,
+                                m_numX - 1)};
+    const int xEnd{std::clamp(cellIndex(box.xMax - m_origin.x()), 0,
+                              m_numX - 1)};
+    const int yBegin{std::clamp(cellIndex(box.yMin - m_origin.y()), 0,
+                                m_numY - 1)};
+    const int yEnd{std::clamp(cellIndex(box.yMax - m_origin.y()), 0,
+                              m_numY - 1)};
+
+    for (int cy{yBegin}; cy <= yEnd; ++cy)
+      for (int cx{xBegin}; cx <= xEnd; ++cx)
+        apply(cy * m_numX + cx);
+  }
+};
+}; // namespace Internal
+}; // namespace FrenetTransform
+
+#endif
@@ -0,0 +1,113 @@
+#ifndef SEGMENT_RASTER_H
+#define SEGMENT_RASTER_H
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "frenetTransform/internal/segmentTree.h"
+#include "frenetTransform/point.h"
+
+namespace FrenetTransform {
+namespace Internal {
+/**
+ * @brief Raster over a bounded region storing the polychain segments that may
+ * be closest to any point in each cell.
+ * Segments are identified by the index of their end point. The first segment
+ * of each cell is the one closest to the cell center. Cells are stored in a
+ * flat array with row-major order.
+ *
+ */
+class SegmentRaster {
+public:
+  SegmentRaster() = default;
+
+  /**
+   * @brief Construct a new SegmentRaster over the region between "lower" and
+   * "upper" corner.
+   *
+   * @tparam Candidates callable taking the cell box and a vector to append
+   * the candidate segments of the cell to.
+   * @param lower corner of the region with minimum coordinates.
+   * @param upper corner of the region with maximum coordinates.
+   * @param resolution side length of the square raster cells.
+   * @param candidates determines the candidate segments of a cell.
+   */
+  template <typename Candidates>
+  SegmentRaster(const Point &lower, const Point &upper, double resolution,
+                Candidates &&candidates)
+      : m_lower{lower}, m_upper{upper}, m_resolution{resolution} {
+    if (!(resolution > 0.0) || !(upper.x() >= lower.x()) ||
+        !(upper.y() >= lower.y()))
+      return;
+
+    m_numX = std::max(
+        static_cast<int>(std::ceil((upper.x() - lower.x()) / resolution)), 1);
+    m_numY = std::max(
+        static_cast<int>(std::ceil((upper.y() - lower.y()) / resolution)), 1);
+
+    // collect candidate segments of all cells
+    m_cellBegin.reserve(m_numX * m_numY + 1);
+    m_cellBegin.push_back(0);
+    for (int cy{}; cy < m_numY; ++cy) {
+      for (int cx{}; cx < m_numX; ++cx) {
+        const Box cell{lower.x() + cx * resolution, lower.y() + cy * resolution,
+                       lower.x() + (cx + 1) * resolution,
+                       lower.y() + (cy + 1) * resolution};
+        candidates(cell, m_segments);
+        m_cellBegin.push_back(static_cast<int>(m_segments.size()));
+      }
+    }
+  }
+
+  /**
+   * @brief Whether the raster contains no cells.
+   *
+   * @return true if no cells are stored.
+   */
+  bool empty() const { return m_cellBegin.empty(); }
+
+  /**
+   * @brief Visits the candidate segments of the cell containing "point".
+   *
+   * @tparam Visitor callable taking a segment index.
+   * @param point query point.
+   * @param visit evaluates the distance to a segment.
+   * @return true if "point" is inside the raster region.
+   */
+  template <typename Visitor>
+  bool nearest(const Point &point, Visitor &&visit) const {
+    if (empty() || !(point.x() >= m_lower.x() && point.x() <= m_upper.x() &&
+                     point.y() >= m_lower.y() && point.y() <= m_upper.y()))
+      return false;
+
+    // points at the upper region boundary belong to the last cells
+    const int cx{std::min(
+        static_cast<int>((point.x() - m_lower.x()) / m_resolution),
+        m_numX - 1)};
+    const int cy{std::min(
+        static_cast<int>((point.y() - m_lower.y()) / m_resolution),
+        m_numY - 1)};
+
+    const int cell{cy * m_numX + cx};
+    for (int cSegment{m_cellBegin[cell]}; cSegment < m_cellBegin[cell + 1];
+         ++cSegment)
+      visit(m_segments[cSegment]);
+
+    return true;
+  }
+
+private:
+  Point m_lower{};          /**<< corner with minimum coordinates */
+  Point m_upper{};          /**<< corner with maximum coordinates */
+  double m_resolution{1.0}; /**<< side length of the raster cells */
+  int m_numX{};             /**<< number of cells in x-direction */
+  int m_numY{};             /**<< number of cells in y-direction */
+
+  std::vector<int> m_cellBegin{}; /**<< offsets of each cell in m_segments */
+  std::vector<int> m_segments{};  /**<< candidate segments ordered by cells */
+};
+}; // namespace Internal
+}; // namespace FrenetTransform
+
+#endif
@@ -0,0 +1,293 @@
+#ifndef SEGMENT_TREE_H
+#define SEGMENT_TREE_H
+
+#include <Eigen/Core>
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "frenetTransform/point.h"
+
+namespace FrenetTransform {
+namespace Internal {
+/**
+ * @brief Axis-aligned bounding box.
+ *
+ */
+struct Box {
+  double xMin{std::numeric_limits<double>::infinity()}; /**<< lower x-bound */
+  double yMin{std::numeric_limits<double>::infinity()}; /**<< lower y-bound */
+  double xMax{-std::numeric_limits<double>::infinity()}; /**<< upper x-bound */
+  double yMax{-std::numeric_limits<double>::infinity()}; /**<< upper y-bound */
+
+  /**
+   * @brief Extend the box to contain "point".
+   *
+   * @param point to include in the box.
+   */
+  void extend(const Point &point) {
+    xMin = std::min(xMin, point.x());
+    yMin = std::min(yMin, point.y());
+    xMax = std::max(xMax, point.x());
+    yMax = std::max(yMax, point.y());
+  }
+
+  /**
+   * @brief Extend the box to contain another "box".
+   *
+   * @param box to include in the box.
+   */
+  void extend(const Box &box) {
+    xMin = std::min(xMin, box.xMin);
+    yMin = std::min(yMin, box.yMin);
+    xMax = std::max(xMax, box.xMax);
+    yMax = std::max(yMax, box.yMax);
+  }
+
+  /**
+   * @brief Squared distance between the box and a query "point".
+   * Points inside the box have zero distance.
+   *
+   * @param point to determine the squared distance to.
+   * @return double squared distance to "point".
+   */
+  double distanceSquare(const Point &point) const {
+    const double dx{std::max({xMin - point.x(), 0.0, point.x() - xMax})};
+    const double dy{std::max({yMin - point.y(), 0.0, point.y() - yMax})};
+    return dx * dx + dy * dy;
+  }
+
+  /**
+   * @brief Squared distance between the box and the segment from "start" to
+   * "end". Segments intersecting the box have zero distance.
+   *
+   * @param start point at the segment start.
+   * @param end point at the segment end.
+   * @return double squared distance to the segment.
+   */
+  double distanceSquare(const Point &start, const Point &end) const {
+    // clip segment parameters to the box slabs in x- and y-direction
+    double partMin{0.0};
+    double partMax{1.0};
+    const auto clip{[&partMin, &partMax](double origin, double direction,
+                                         double lower, double upper) {
+      if (direction == 0.0)
+        return origin >= lower && origin <= upper;
+      double part1{(lower - origin) / direction};
+      double part2{(upper - origin) / direction};
+      if (part1 > part2)
+        std::swap(part1, part2);
+      partMin = std::max(partMin, part1);
+      partMax = std::min(partMax, part2);
+      return partMin <= partMax;
+    }};
+    const Point direction{end - start};
+    if (clip(start.x(), direction.x(), xMin, xMax) &&
+        clip(start.y(), direction.y(), yMin, yMax))
+      return 0.0;
+
+    // closest points are segment ends or box corners otherwise
+    double result{std::min(distanceSquare(start), distanceSquare(end))};
+    for (const Point &corner :
+         {Point{xMin, yMin}, Point{xMax, yMin}, Point{xMin, yMax},
+          Point{xMax, yMax}}) {
+      const Point diff{corner - start};
+      const double lengthSquare{direction.x() * direction.x() +
+                                direction.y() * direction.y()};
+      const double part{
+          lengthSquare > 0.0
+              ? std::clamp((diff.x() * direction.x() +
+                            diff.y() * direction.y()) /
+                               lengthSquare,
+                           0.0, 1.0)
+              : 0.0};
+      const Point closest{start.x() + part * direction.x(),
+                          start.y() + part * direction.y()};
+      result = std::min(result, corner.distanceSquare(closest));
+    }
+    return result;
+  }
+};
+
+/**
+ * @brief Bounding volume hierarchy over the segments of a polychain.
+ * Segments are identified by the index of their end point, such that segment
+ * "cPoints" connects the points "cPoints - 1" and "cPoints". Nodes are split at
+ * the median segment center along their longest box side.
+ *
+ */
+class SegmentTree {
+public:
+  SegmentTree() = default;
+
+  /**
+   * @brief Construct a new SegmentTree over the segments between consecutive
+   * points.
+   *
+   * @tparam ArrayType array type of coordinates.
+   * @param x coordinates in x-direction along the polychain.
+   * @param y coordinates in y-direction along the polychain.
+   */
+  template <typename ArrayType>
+  SegmentTree(const Eigen::ArrayBase<ArrayType> &x,
+              const Eigen::ArrayBase<ArrayType> &y) {
+    const int numSegments{static_cast<int>(x.rows()) - 1};
+    if (numSegments < 1)
+      return;
+
+    m_boxes.resize(numSegments);
+    for (int cSegment{}; cSegment < numSegments; ++cSegment) {
+      m_boxes[cSegment].extend(Point{x(cSegment), y(cSegment)});
+      m_boxes[cSegment].extend(Point{x(cSegment + 1), y(cSegment + 1)});
+    }
+    init();
+  }
+
+  /**
+   * @brief Construct a new SegmentTree over segments of any shape given by
+   * their bounding boxes. Box "cSegment - 1" bounds segment "cSegment".
+   *
+   * @param boxes bounding boxes of the segments.
+   */
+  explicit SegmentTree(std::vector<Box> boxes) : m_boxes{std::move(boxes)} {
+    if (!m_boxes.empty())
+      init();
+  }
+
+  /**
+   * @brief Whether the tree contains no segments.
+   *
+   * @return true if no segments are stored.
+   */
+  bool empty() const { return m_nodes.empty(); }
+
+  /**
+   * @brief Visits the segments that may be closer to "point" than the current
+   * minimum squared distance. Nodes are visited nearest first and pruned if
+   * their box is farther than the current minimum.
+   *
+   * @tparam Visitor callable taking a segment index and returning the updated
+   * minimum squared distance.
+   * @param point query point.
+   * @param visit evaluates the distance to a segment.
+   * @param distanceSquare initial minimum squared distance.
+   */
+  template <typename Visitor>
+  void nearest(const Point &point, Visitor &&visit,
+               double distanceSquare =
+                   std::numeric_limits<double>::infinity()) const {
+    if (m_nodes.empty())
+      return;
+
+    std::array<int, s_stackSize> stack{}; // nodes pending for visit
+    int numStack{};
+    stack[numStack++] = 0;
+
+    while (numStack > 0) {
+      const Node &node{m_nodes[stack[--numStack]]};
+
+      if (node.box.distanceSquare(point) > distanceSquare)
+        continue;
+
+      // evaluate all segments in leaf
+      if (node.left < 0) {
+        for (int cSegment{node.begin}; cSegment < node.end; ++cSegment)
+          distanceSquare = visit(m_segments[cSegment]);
+        continue;
+      }
+
+      // push farther child first to visit nearer child next
+      const double distanceLeft{m_nodes[node.left].box.distanceSquare(point)};
+      const double distanceRight{
+          m_nodes[node.right].box.distanceSquare(point)};
+      if (distanceLeft < distanceRight) {
+        stack[numStack++] = node.right;
+        stack[numStack++] = node.left;
+      } else {
+        stack[numStack++] = node.left;
+        stack[numStack++] = node.right;
+      }
+    }
+  }
+
+private:
+  /**
+   * @brief Tree node covering the segments in range "begin" to "end".
+   *
+   */
+  struct Node {
+    Box box{};     /**<< bounding box of all segments in the node */
+    int left{-1};  /**<< index of left child, -1 for leaves */
+    int right{-1}; /**<< index of right child, -1 for leaves */
+    int begin{};   /**<< first segment in the node */
+    int end{};     /**<< segment after the last one in the node */
+  };
+
+  static constexpr int s_leafSize{4}; /**<< maximum segments per leaf */
+  static constexpr int s_stackSize{128}; /**<< maximum pending nodes */
+
+  std::vector<Node> m_nodes{};   /**<< tree nodes with root at front */
+  std::vector<Box> m_boxes{};    /**<< boxes of segments by storage index */
+  std::vector<int> m_segments{}; /**<< segment indices ordered by leaves */
+
+  /**
+   * @brief Builds the tree over all segment boxes.
+   *
+   */
+  void init() {
+    const int numSegments{static_cast<int>(m_boxes.size())};
+    m_segments.resize(numSegments);
+    std::iota(m_segments.begin(), m_segments.end(), 1);
+
+    m_nodes.reserve(2 * (numSegments / s_leafSize + 1));
+    build(0, numSegments);
+  }
+
+  /**
+   * @brief Recursively builds the node covering the segments in range "begin"
+   * to "end".
+   *
+   * @param begin first segment in the node.
+   * @param end segment after the last one in the node.
+   * @return int index of the built node.
+   */
+  int build(int begin, int end) {
+    const int index{static_cast<int>(m_nodes.size())};
+    m_nodes.push_back({});
+
+    Box box{};
+    for (int cSegment{begin}; cSegment < end; ++cSegment)
+      box.extend(m_boxes[m_segments[cSegment] - 1]);
+
+    int left{-1};
+    int right{-1};
+    if (end - begin > s_leafSize) {
+      // split at median segment center along longest box side
+      const bool splitX{box.xMax - box.xMin > box.yMax - box.yMin};
+      const auto center{[this, splitX](int segment) {
+        const Box &segmentBox{m_boxes[segment - 1]};
+        return splitX ? segmentBox.xMin + segmentBox.xMax
+                      : segmentBox.yMin + segmentBox.yMax;
+      }};
+      const int middle{begin + (end - begin) / 2};
+      std::nth_element(m_segments.begin() + begin,
+                       m_segments.begin() + middle, m_segments.begin() + end,
+                       [&center](int segment1, int segment2) {
+                         return center(segment1) < center(segment2);
+                       });
+
+      left = build(begin, middle);
+      right = build(middle, end);
+    }
+
+    m_nodes[index] = {box, left, right, begin, end};
+    return index;
+  }
+};
+}; // namespace Internal
+}; // namespace FrenetTransform
+
+#endif
@@ -13,31 +13,32 @@ public:
 };
 
 template <int NumQueries = Eigen::Dynamic>
-class TransformCircle : public Transform<NumQueries> {
+class TransformCircle : public Transform<NumQueries, Circle<NumQueries>> {
 public:
   TransformCircle(std::shared_ptr<Circle<NumQueries>> circle)
-      : Transform<NumQueries>(circle), m_path{circle} {}
+      : Transform<NumQueries, Circle<NumQueries>>(circle) {}
 
   Points<NumQueries>
   posFrenet(const Points<NumQueries, PointCircle> &posCircle) const {
-    return {m_path->radius() * (posCircle.y() - m_path->angleOffset()),
-            m_path->radius() - posCircle.x()};
+    return {this->m_path->radius() *
+                (posCircle.y() - this->m_path->angleOffset()),
+            this->m_path->radius() - posCircle.x()};
   }
 
   Points<NumQueries>
   velFrenet(const Points<NumQueries, PointCircle> &velCircle) const {
-    return {m_path->radius() * velCircle.y(), -velCircle.x()};
+    return {this->m_path->radius() * velCircle.y(), -velCircle.x()};
   }
 
   Points<NumQueries>
   accFrenet(const Points<NumQueries, PointCircle> &accCircle) const {
-    return {m_path->radius() * accCircle.y(), -accCircle.x()};
+    return {this->m_path->radius() * accCircle.y(), -accCircle.x()};
   }
 
   Points<NumQueries>
   posCartes(const Points<NumQueries, PointCircle> &posCircle) const {
-    return {posCircle.x() * posCircle.y().cos() + m_path->center().x(),
-            posCircle.x() * posCircle.y().sin() + m_path->center().y()};
+    return {posCircle.x() * posCircle.y().cos() + this->m_path->center().x(),
+            posCircle.x() * posCircle.y().sin() + this->m_path->center().y()};
   }
 
   Points<NumQueries>
@@ -64,9 +65,6 @@ public:
                  posCircle.x() * accCircle.y()) *
                     posCircle.y().cos()};
   }
-
-private:
-  const std::shared_ptr<Circle<NumQueries>> m_path;
 };
 }; // namespace Internal
 }; // namespace FrenetTransform
@@ -3,9 +3,13 @@
 
 #include <Eigen/Core>
 #include <array>
+#include <cmath>
 #include <math.h>
+#include <utility>
 
+#include "frenetTransform/frames.h"
 #include "frenetTransform/internal/math.h"
+#include "frenetTransform/point.h"
 #include "frenetTransform/points.h"
 
 namespace FrenetTransform {
@@ -14,10 +18,17 @@ namespace FrenetTransform {
  *
  * The properties include orientation, curvature, cuvature change, normal and
  * tangential.
+ *
+ * @tparam NumQueries number of query points with -1 for dynamic point number.
+ * @tparam ScalarType floating point type of the query points and properties.
  */
-template <int NumQueries = Eigen::Dynamic> class Path {
+template <int NumQueries = Eigen::Dynamic, typename ScalarType = double>
+class Path {
 public:
-  using ArrayQueries = Eigen::Array<double, NumQueries, 1>;
+  using Scalar = ScalarType;
+  using Point = BasicPoint<Scalar>;
+  using PointsQueries = Points<NumQueries, Point>;
+  using ArrayQueries = Eigen::Array<Scalar, NumQueries, 1>;
 
   virtual ~Path() = default;
 
@@ -27,7 +38,7 @@ public:
    * @param lengths lengths along the path.
    * @return points at given path lengths.
    */
-  virtual Points<NumQueries> operator()(const ArrayQueries &lengths) const = 0;
+  virtual PointsQueries operator()(const ArrayQueries &lengths) const = 0;
 
   /**
    * @brief Determines tangent vectors at the given path lengths.
@@ -35,7 +46,7 @@ public:
    * @param lengths lengths along the path.
    * @return tangent vectors.
    */
-  Points<NumQueries> tangent(const ArrayQueries &lengths) const {
+  PointsQueries tangent(const ArrayQueries &lengths) const {
     return gradient1(lengths);
   }
 
@@ -45,8 +56,8 @@ public:
    * @param lengths lengths along the path.
    * @return normal vectors.
    */
-  Points<NumQueries> normal(const ArrayQueries &lengths) const {
-    const Points<NumQueries> tangents{tangent(lengths)};
+  PointsQueries normal(const ArrayQueries &lengths) const {
+    const PointsQueries tangents{tangent(lengths)};
     return {-tangents.y(), tangents.x()};
   }
 
@@ -54,9 +65,51 @@ public:
    * @brief Determines next points to the query points.
    *
    * @param points query points.
-   * @return Points<NumQueries> next to query points.
+   * @return PointsQueries next to query points.
+   */
+  virtual ArrayQueries lengths(const PointsQueries &points) const = 0;
+
+  /**
+   * @brief Determines next points to the query points close to previous
+   * lengths. Paths without local search ignore the hints.
+   *
+   * @param points query points.
+   * @param hints previous lengths along the path for each query point.
+   * @param window maximum length difference to the hints searched locally.
+   * @return ArrayQueries lengths next to query points.
+   */
+  virtual ArrayQueries lengths(const PointsQueries &points,
+                               const ArrayQueries & /*hints*/,
+                               Scalar /*window*/) const {
+    return lengths(points);
+  }
+
+  /**
+   * @brief Determines next points to the query points into caller-provided
+   * lengths. Paths with allocation-free searches override this method, others
+   * fall back to the allocating one.
+   *
+   * @param points query points.
+   * @param result lengths next to query points.
+   */
+  virtual void lengths(const PointsQueries &points,
+                       ArrayQueries &result) const {
+    result = lengths(points);
+  }
+
+  /**
+   * @brief Determines next points to the query points close to previous
+   * lengths into caller-provided lengths.
+   *
+   * @param points query points.
+   * @param hints previous lengths along the path for each query point.
+   * @param window maximum length difference to the hints searched locally.
+   * @param result lengths next to query points.
    */
-  virtual ArrayQueries lengths(const Points<NumQueries> &points) const = 0;
+  virtual void lengths(const PointsQueries &points, const ArrayQueries &hints,
+                       Scalar window, ArrayQueries &result) const {
+    result = lengths(points, hints, window);
+  }
 
   /**
    * @brief Determines path angle at the given path lengths.
@@ -65,7 +118,7 @@ public:
    * @return path angles.
    */
   ArrayQueries angle0(const ArrayQueries &lengths) const {
-    const Points<NumQueries> tangents{tangent(lengths)};
+    const PointsQueries tangents{tangent(lengths)};
 
     return angleDir(tangents.x(), tangents.y());
   }
@@ -77,10 +130,7 @@ public:
    * @return path curvatures.
    */
   ArrayQueries angle1(const ArrayQueries &lengths) const {
-    const auto grad1{gradient1(lengths)};
-    const auto grad2{gradient2(lengths)};
-    const auto grad1Abs{(grad1.x().square() + grad1.y().square()).sqrt()};
-    return -(grad1.y() * grad2.x() - grad1.x() * grad2.y()) / grad1Abs.pow(3);
+    return curvature(gradient1(lengths), gradient2(lengths));
   }
 
   /**
@@ -90,26 +140,232 @@ public:
    * @return path curvatures.
    */
   ArrayQueries angle2(const ArrayQueries &lengths) const {
-    const auto grad1{gradient1(lengths)};
-    const auto grad1Abs{(grad1.x().square() + grad1.y().square()).sqrt()};
+    return curvatureRate(gradient1(lengths), gradient2(lengths),
+                         gradient3(lengths));
+  }
+
+  /**
+   * @brief Determines the Frenet frames at the given path lengths in a single
+   * pass. Only evaluates the gradients required by the requested properties.
+   *
+   * @param lengths lengths along the path.
+   * @param properties mask of FrameProperty values to determine.
+   * @return Frames<NumQueries, Scalar> frames with the requested properties.
+   */
+  virtual Frames<NumQueries, Scalar>
+  frames(const ArrayQueries &lengths,
+         unsigned int properties = FrameAll) const {
+    return framesFrom(
+        properties,
+        properties & FramePoints ? operator()(lengths) : PointsQueries{},
+        properties & (FrameTangents | FrameCurvatures | FrameCurvatureRates)
+            ? gradient1(lengths)
+            : PointsQueries{},
+        properties & (FrameCurvatures | FrameCurvatureRates)
+            ? gradient2(lengths)
+            : PointsQueries{},
+        properties & FrameCurvatureRates ? gradient3(lengths)
+                                         : PointsQueries{});
+  }
+
+  /**
+   * @brief Determines the Frenet frames at the given path lengths into
+   * caller-provided frames. Properties not requested remain unchanged. Paths
+   * with allocation-free evaluation override this method, others fall back to
+   * the allocating one.
+   *
+   * @param lengths lengths along the path.
+   * @param properties mask of FrameProperty values to determine.
+   * @param result frames with the requested properties.
+   */
+  virtual void frames(const ArrayQueries &lengths, unsigned int properties,
+                      Frames<NumQueries, Scalar> &result) const {
+    Frames<NumQueries, Scalar> frames{this->frames(lengths, properties)};
+    if (properties & FramePoints)
+      result.points = std::move(frames.points);
+    if (properties & FrameTangents) {
+      result.tangents = std::move(frames.tangents);
+      result.normals = std::move(frames.normals);
+    }
+    if (properties & FrameCurvatures)
+      result.curvatures = std::move(frames.curvatures);
+    if (properties & FrameCurvatureRates)
+      result.curvatureRates = std::move(frames.curvatureRates);
+  }
+
+  /**
+   * @brief Determines the next point to a single query point. Paths with a
+   * scalar search override this method, others fall back to the array
+   * interface.
+   *
+   * @param point query point.
+   * @return Scalar length next to the query point.
+   */
+  virtual Scalar length(const Point &point) const {
+    return lengths(PointsQueries{
+        ArrayQueries::Constant(s_numFallback, point.x()),
+        ArrayQueries::Constant(s_numFallback, point.y())})(0);
+  }
+
+  /**
+   * @brief Determines the next point to a single query point close to a
+   * previous length. Paths without local search ignore the hint.
+   *
+   * @param point query point.
+   * @param hint previous length along the path.
+   * @param window maximum length difference to the hint searched locally.
+   * @return Scalar length next to the query point.
+   */
+  virtual Scalar length(const Point &point, Scalar /*hint*/,
+                        Scalar /*window*/) const {
+    return length(point);
+  }
+
+  /**
+   * @brief Determines the Frenet frame at a single path length. Paths with a
+   * scalar evaluation override this method, others fall back to the array
+   * interface.
+   *
+   * @param length length along the path.
+   * @param properties mask of FrameProperty values to determine.
+   * @return Frame<Scalar> frame with the requested properties.
+   */
+  virtual Frame<Scalar> frame(Scalar length,
+                              unsigned int properties = FrameAll) const {
+    const Frames<NumQueries, Scalar> frames{
+        this->frames(ArrayQueries::Constant(s_numFallback, length),
+                     properties)};
+    Frame<Scalar> result{};
+    if (properties & FramePoints)
+      result.point = frames.points(0);
+    if (properties & FrameTangents) {
+      result.tangent = frames.tangents(0);
+      result.normal = frames.normals(0);
+    }
+    if (properties & FrameCurvatures)
+      result.curvature = frames.curvatures(0);
+    if (properties & FrameCurvatureRates)
+      result.curvatureRate = frames.curvatureRates(0);
+    return result;
+  }
+
+protected:
+  /**
+   * @brief Assembles Frenet frames from points and gradients along the path.
+   * Gradients not required by the requested properties may be empty.
+   *
+   * @param properties mask of FrameProperty values to determine.
+   * @param points points along the path.
+   * @param grad1 1st order gradients along the path.
+   * @param grad2 2nd order gradients along the path.
+   * @param grad3 3rd order gradients along the path.
+   * @return Frames<NumQueries, Scalar> frames with the requested properties.
+   */
+  static Frames<NumQueries, Scalar>
+  framesFrom(unsigned int properties, PointsQueries points,
+             const PointsQueries &grad1, const PointsQueries &grad2,
+             const PointsQueries &grad3) {
+    Frames<NumQueries, Scalar> result{};
+    if (properties & FramePoints)
+      result.points = std::move(points);
+    if (properties & FrameTangents) {
+      result.tangents = grad1;
+      result.normals = {-grad1.y(), grad1.x()};
+    }
+    if (properties & FrameCurvatures)
+      result.curvatures = curvature(grad1, grad2);
+    if (properties & FrameCurvatureRates)
+      result.curvatureRates = curvatureRate(grad1, grad2, grad3);
+    return result;
+  }
+
+  /**
+   * @brief Determines the path curvature from gradients at a single point.
+   *
+   * @tparam PointScalar floating point type of the gradients.
+   * @param grad1 1st order gradient along the path.
+   * @param grad2 2nd order gradient along the path.
+   * @return PointScalar path curvature.
+   */
+  template <typename PointScalar>
+  static PointScalar curvature(const BasicPoint<PointScalar> &grad1,
+                               const BasicPoint<PointScalar> &grad2) {
+    const PointScalar grad1Abs{
+        std::sqrt(grad1.x() * grad1.x() + grad1.y() * grad1.y())};
+    return -(grad1.y() * grad2.x() - grad1.x() * grad2.y()) /
+           (grad1Abs * grad1Abs * grad1Abs);
+  }
 
-    const auto grad2{gradient2(lengths)};
-    const auto grad3{gradient3(lengths)};
+  /**
+   * @brief Determines the path curvature derivative from gradients at a single
+   * point.
+   *
+   * @tparam PointScalar floating point type of the gradients.
+   * @param grad1 1st order gradient along the path.
+   * @param grad2 2nd order gradient along the path.
+   * @param grad3 3rd order gradient along the path.
+   * @return PointScalar path curvature derivative.
+   */
+  template <typename PointScalar>
+  static PointScalar curvatureRate(const BasicPoint<PointScalar> &grad1,
+                                   const BasicPoint<PointScalar> &grad2,
+                                   const BasicPoint<PointScalar> &grad3) {
+    const PointScalar grad1AbsSquare{grad1.x() * grad1.x() +
+                                     grad1.y() * grad1.y()};
+    const PointScalar grad1Abs{std::sqrt(grad1AbsSquare)};
 
-    return (grad1.x() * grad3.y() - grad3.x() * grad1.y()) / grad1Abs.pow(3) -
+    return (grad1.x() * grad3.y() - grad3.x() * grad1.y()) /
+               (grad1AbsSquare * grad1Abs) -
            (grad1.x() * grad2.x() + grad1.y() * grad2.y()) *
                (grad1.x() * grad2.y() - grad2.x() * grad1.y()) /
-               grad1Abs.pow(5);
+               (grad1AbsSquare * grad1AbsSquare * grad1Abs);
   }
 
 private:
+  // number of repeated queries of the array fallbacks for single queries
+  static constexpr int s_numFallback{
+      NumQueries == Eigen::Dynamic ? 1 : NumQueries};
+
+  /**
+   * @brief Determines path curvatures from gradients along the path.
+   *
+   * @param grad1 1st order gradients along the path.
+   * @param grad2 2nd order gradients along the path.
+   * @return path curvatures.
+   */
+  static ArrayQueries curvature(const PointsQueries &grad1,
+                                const PointsQueries &grad2) {
+    ArrayQueries result(grad1.numPoints());
+    for (int row{}; row < grad1.numPoints(); ++row)
+      result(row) = curvature(grad1(row), grad2(row));
+    return result;
+  }
+
+  /**
+   * @brief Determines path curvature derivatives from gradients along the
+   * path.
+   *
+   * @param grad1 1st order gradients along the path.
+   * @param grad2 2nd order gradients along the path.
+   * @param grad3 3rd order gradients along the path.
+   * @return path curvature derivatives.
+   */
+  static ArrayQueries curvatureRate(const PointsQueries &grad1,
+                                    const PointsQueries &grad2,
+                                    const PointsQueries &grad3) {
+    ArrayQueries result(grad1.numPoints());
+    for (int row{}; row < grad1.numPoints(); ++row)
+      result(row) = curvatureRate(grad1(row), grad2(row), grad3(row));
+    return result;
+  }
+
   /**
    * @brief Determines 1st order gradient at the given path lengths.
    *
    * @param lengths lengths along the path.
    * @return 1st order gradient at given path lengths.
    */
-  virtual Points<NumQueries> gradient1(const ArrayQueries &lengths) const = 0;
+  virtual PointsQueries gradient1(const ArrayQueries &lengths) const = 0;
 
   /**
    * @brief Determines 2nd order gradient at the given path lengths.
@@ -117,7 +373,7 @@ private:
    * @param lengths lengths along the path.
    * @return 2nd order gradient at given path lengths.
    */
-  virtual Points<NumQueries> gradient2(const ArrayQueries &lengths) const = 0;
+  virtual PointsQueries gradient2(const ArrayQueries &lengths) const = 0;
 
   /**
    * @brief Determines 3rd order gradient at the given path lengths.
@@ -125,7 +381,7 @@ private:
    * @param lengths lengths along the path.
    * @return 3rd order gradient at given path lengths.
    */
-  virtual Points<NumQueries> gradient3(const ArrayQueries &lengths) const = 0;
+  virtual PointsQueries gradient3(const ArrayQueries &lengths) const = 0;
 };
 }; // namespace FrenetTransform
 
@@ -7,10 +7,13 @@ namespace FrenetTransform {
 /**
  * @brief Representation of a 2-dimensional point.
  *
+ * @tparam ScalarType type of the coordinates.
  */
-class Point {
+template <typename ScalarType = double> class BasicPoint {
 public:
-  Point() = default;
+  using Scalar = ScalarType;
+
+  BasicPoint() = default;
 
   /**
    * @brief Construct a new Point with coordinates in x- and y-direction.
@@ -18,29 +21,40 @@ public:
    * @param x point's coordinate in x-direction.
    * @param y point's coordinate in y-direction.
    */
-  Point(double x, double y) : m_x{x}, m_y{y} {}
+  BasicPoint(Scalar x, Scalar y) : m_x{x}, m_y{y} {}
+
+  /**
+   * @brief Construct a new Point by converting the coordinates of "point".
+   *
+   * @tparam OtherScalar type of the coordinates of "point".
+   * @param point to convert.
+   */
+  template <typename OtherScalar>
+  explicit BasicPoint(const BasicPoint<OtherScalar> &point)
+      : m_x{static_cast<Scalar>(point.x())},
+        m_y{static_cast<Scalar>(point.y())} {}
 
   /**
    * @brief Provides the point's coordinate in x-direction.
    *
-   * @return double x-coordinate.
+   * @return Scalar x-coordinate.
    */
-  double x() const { return m_x; }
+  Scalar x() const { return m_x; }
 
   /**
    * @brief Provides the point's coordinate in y-direction.
    *
-   * @return double y-coordinate.
+   * @return Scalar y-coordinate.
    */
-  double y() const { return m_y; }
+  Scalar y() const { return m_y; }
 
   /**
    * @brief Squared distance between Point and a query "point".
    *
    * @param point to determine the squared distance to.
-   * @return double squared distance to "point".
+   * @return Scalar squared distance to "point".
    */
-  double distanceSquare(const Point &point) const {
+  Scalar distanceSquare(const BasicPoint &point) const {
     return std::pow(point.x() - m_x, 2) + std::pow(point.y() - m_y, 2);
   }
 
@@ -48,9 +62,9 @@ public:
    * @brief Distance between Point and a query "point".
    *
    * @param point to determine the distance to.
-   * @return double distance to "point".
+   * @return Scalar distance to "point".
    */
-  double distance(const Point &point) const {
+  Scalar distance(const BasicPoint &point) const {
     return std::sqrt(distanceSquare(point));
   }
 
@@ -59,7 +73,7 @@ public:
    *
    * @return Point with negated x- and y-coordinates.
    */
-  Point operator-() const { return {-m_x, -m_y}; }
+  BasicPoint operator-() const { return {-m_x, -m_y}; }
 
   /**
    * @brief Sum between coordinates of two points.
@@ -68,7 +82,8 @@ public:
    * @param point2 second point of the sum.
    * @return Point with sum of coordinates of "point1" and "point2".
    */
-  friend Point operator+(const Point &point1, const Point &point2) {
+  friend BasicPoint operator+(const BasicPoint &point1,
+                              const BasicPoint &point2) {
     return {point1.x() + point2.x(), point1.y() + point2.y()};
   }
 
@@ -79,14 +94,21 @@ public:
    * @param point2 second point of the difference.
    * @return Point with difference of coordinates of "point1" and "point2".
    */
-  friend Point operator-(const Point &point1, const Point &point2) {
+  friend BasicPoint operator-(const BasicPoint &point1,
+                              const BasicPoint &point2) {
     return {point1 + (-point2)};
   }
 
 private:
-  double m_x{}; /**<< x-coordinate */
-  double m_y{}; /**<< y-coordinate */
+  Scalar m_x{}; /**<< x-coordinate */
+  Scalar m_y{}; /**<< y-coordinate */
 };
+
+/**
+ * @brief Point with coordinates in double precision.
+ *
+ */
+using Point = BasicPoint<double>;
 }; // namespace FrenetTransform
 
 #endif
\ No newline at end of file
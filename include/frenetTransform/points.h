@@ -3,19 +3,269 @@
 
 #include <Eigen/Core>
 #include <cassert>
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 
 #include "frenetTransform/point.h"
 
 namespace FrenetTransform {
+/**
+ * @brief Common base of point sequences, stored or lazily evaluated.
+ * Arithmetic operators on point sequences build PointsExpression objects,
+ * such that chained operations evaluate in a single loop per coordinate once
+ * assigned to Points.
+ *
+ * @tparam Derived type of the point sequence.
+ * @tparam PointType type of points.
+ */
+template <typename Derived, typename PointType> class PointsBase {
+public:
+  /**
+   * @brief Get the derived point sequence.
+   *
+   * @return const Derived& derived point sequence.
+   */
+  const Derived &derived() const { return static_cast<const Derived &>(*this); }
+};
+
+/**
+ * @brief Lazily evaluated point sequence applying an operation to its
+ * operands. Like Eigen, operands passed as lvalues are referenced and must
+ * outlive the expression, while temporary operands are moved into the
+ * expression. Expressions over temporaries thus remain valid after the
+ * statement that built them.
+ *
+ * @tparam Operation provides the Eigen expressions of x- and y-coordinates
+ * from the operands.
+ * @tparam PointType type of points.
+ * @tparam Operands types holding the operands.
+ */
+template <typename Operation, typename PointType, typename... Operands>
+class PointsExpression
+    : public PointsBase<PointsExpression<Operation, PointType, Operands...>,
+                        PointType> {
+public:
+  /**
+   * @brief Construct a new PointsExpression from its operands.
+   *
+   * @param operands operands of the operation.
+   */
+  explicit PointsExpression(Operands... operands)
+      : m_operands{std::forward<Operands>(operands)...} {}
+
+  /**
+   * @brief Evaluate point at "index" along the point sequence.
+   *
+   * @param index of point along the point sequence.
+   * @return PointType point at the "index".
+   */
+  PointType operator()(const int index) const {
+    return {x()(index), y()(index)};
+  }
+
+  /**
+   * @brief Provide the number of points along the sequence.
+   *
+   * @return int number of points.
+   */
+  int numPoints() const { return static_cast<int>(x().rows()); }
+
+  /**
+   * @brief Get expression of x-coordinates along the point sequence.
+   *
+   * @return Eigen expression of x-coordinates, referencing the operands.
+   */
+  decltype(auto) x() const {
+    return std::apply(
+        [](const auto &...operands) -> decltype(auto) {
+          return Operation::x(operands...);
+        },
+        m_operands);
+  }
+
+  /**
+   * @brief Get expression of y-coordinates along the point sequence.
+   *
+   * @return Eigen expression of y-coordinates, referencing the operands.
+   */
+  decltype(auto) y() const {
+    return std::apply(
+        [](const auto &...operands) -> decltype(auto) {
+          return Operation::y(operands...);
+        },
+        m_operands);
+  }
+
+private:
+  std::tuple<Operands...> m_operands; /**<< operands of the operation */
+};
+
+namespace Internal {
+/**
+ * @brief Deduce the type of points of a point sequence. Only declared for
+ * use in unevaluated contexts.
+ *
+ * @tparam Derived type of the point sequence.
+ * @tparam PointType type of points.
+ * @param points point sequence.
+ * @return PointType type of points.
+ */
+template <typename Derived, typename PointType>
+PointType pointTypeOf(const PointsBase<Derived, PointType> &points);
+
+/**
+ * @brief Point sequences, i.e. types derived from PointsBase.
+ *
+ * @tparam Sequence type of the point sequence, possibly a reference.
+ */
+template <typename Sequence>
+concept PointsSequence =
+    requires(const std::remove_cvref_t<Sequence> &points) {
+      Internal::pointTypeOf(points);
+    };
+
+/**
+ * @brief Type of points of a point sequence.
+ *
+ * @tparam Sequence type of the point sequence, possibly a reference.
+ */
+template <typename Sequence>
+using PointTypeOf = decltype(Internal::pointTypeOf(
+    std::declval<const std::remove_cvref_t<Sequence> &>()));
+
+/**
+ * @brief Eigen arrays and array expressions.
+ *
+ * @tparam Array type of the array, possibly a reference.
+ */
+template <typename Array>
+concept ArraySequence =
+    std::is_base_of_v<Eigen::ArrayBase<std::remove_cvref_t<Array>>,
+                      std::remove_cvref_t<Array>>;
+
+/**
+ * @brief Type holding an operand of a PointsExpression. References lvalues
+ * and stores temporaries by value.
+ *
+ * @tparam Operand type of the operand as deduced by a forwarding reference.
+ */
+template <typename Operand>
+using Nested =
+    std::conditional_t<std::is_lvalue_reference_v<Operand>,
+                       const std::remove_reference_t<Operand> &,
+                       std::remove_cvref_t<Operand>>;
+
+/**
+ * @brief Build a PointsExpression holding the forwarded operands.
+ *
+ * @tparam Operation provides the Eigen expressions of the coordinates.
+ * @tparam PointType type of points.
+ * @tparam Operands types of the operands.
+ * @param operands operands of the operation.
+ * @return PointsExpression lazily evaluated point sequence.
+ */
+template <typename Operation, typename PointType, typename... Operands>
+PointsExpression<Operation, PointType, Nested<Operands>...>
+makeExpression(Operands &&...operands) {
+  return PointsExpression<Operation, PointType, Nested<Operands>...>{
+      std::forward<Operands>(operands)...};
+}
+
+/**
+ * @brief Get the x-coordinates of an operand. Point sequences and points
+ * provide their x-coordinates, arrays of scalars apply to both coordinates.
+ *
+ * @tparam Operand type of the operand.
+ * @param operand point sequence, point or array.
+ * @return x-coordinates of the operand.
+ */
+template <typename Operand>
+decltype(auto) coordinateX(const Operand &operand) {
+  if constexpr (ArraySequence<Operand>)
+    return (operand);
+  else
+    return operand.x();
+}
+
+/**
+ * @brief Get the y-coordinates of an operand. Point sequences and points
+ * provide their y-coordinates, arrays of scalars apply to both coordinates.
+ *
+ * @tparam Operand type of the operand.
+ * @param operand point sequence, point or array.
+ * @return y-coordinates of the operand.
+ */
+template <typename Operand>
+decltype(auto) coordinateY(const Operand &operand) {
+  if constexpr (ArraySequence<Operand>)
+    return (operand);
+  else
+    return operand.y();
+}
+
+/**
+ * @brief Operation applying a functor to the coordinates of all operands
+ * element-wise.
+ *
+ * @tparam Functor function object applied to the coordinates.
+ */
+template <typename Functor> struct CoordinateWise {
+  template <typename... Operands> static auto x(const Operands &...operands) {
+    return Functor{}(coordinateX(operands)...);
+  }
+
+  template <typename... Operands> static auto y(const Operands &...operands) {
+    return Functor{}(coordinateY(operands)...);
+  }
+};
+
+/**
+ * @brief Operation providing given Eigen expressions of x- and
+ * y-coordinates.
+ *
+ */
+struct Coordinates {
+  template <typename ExpressionX, typename ExpressionY>
+  static const ExpressionX &x(const ExpressionX &x, const ExpressionY &) {
+    return x;
+  }
+
+  template <typename ExpressionX, typename ExpressionY>
+  static const ExpressionY &y(const ExpressionX &, const ExpressionY &y) {
+    return y;
+  }
+};
+
+/**
+ * @brief Build a PointsExpression from expressions of x- and y-coordinates.
+ *
+ * @tparam PointType type of points.
+ * @tparam ExpressionX Eigen expression of x-coordinates.
+ * @tparam ExpressionY Eigen expression of y-coordinates.
+ * @param x expression of coordinates in x-direction.
+ * @param y expression of coordinates in y-direction.
+ * @return PointsExpression lazily evaluated point sequence.
+ */
+template <typename PointType, typename ExpressionX, typename ExpressionY>
+auto pointsExpression(ExpressionX &&x, ExpressionY &&y) {
+  return makeExpression<Coordinates, PointType>(
+      std::forward<ExpressionX>(x), std::forward<ExpressionY>(y));
+}
+}; // namespace Internal
+
 /**
  * @brief Point sequence.
  *
  * @tparam NumPoints number of points along the sequence.
  * @tparam PointType type of points.
  */
-template <int NumPoints, typename PointType = Point> class Points {
+template <int NumPoints, typename PointType = Point>
+class Points : public PointsBase<Points<NumPoints, PointType>, PointType> {
 public:
-  using ArrayPoints = Eigen::Array<double, NumPoints, 1>;
+  using Scalar = typename PointType::Scalar;
+  using ArrayPoints = Eigen::Array<Scalar, NumPoints, 1>;
 
   Points() = default;
 
@@ -28,6 +278,17 @@ public:
    */
   Points(const ArrayPoints &x, const ArrayPoints &y) : m_x{x}, m_y{y} {}
 
+  /**
+   * @brief Construct a new Points object by evaluating a point sequence, e.g.
+   * the PointsExpression resulting from arithmetic operators.
+   *
+   * @tparam Derived type of the point sequence.
+   * @param points point sequence to evaluate.
+   */
+  template <typename Derived>
+  Points(const PointsBase<Derived, PointType> &points)
+      : m_x{points.derived().x()}, m_y{points.derived().y()} {}
+
   /**
    * @brief Get point at "index" along the point sequence.
    *
@@ -49,17 +310,17 @@ public:
    * @brief Get x-coordinate at "index" along the point sequence.
    *
    * @param index of x-coordinate along the point sequence.
-   * @return double x-coordiante.
+   * @return Scalar x-coordiante.
    */
-  double x(const int index) const { return m_x(index); }
+  Scalar x(const int index) const { return m_x(index); }
 
   /**
    * @brief Get y-coordinate at "index" along the point sequence.
    *
    * @param index of y-coordinate along the point sequence.
-   * @return double y-coordiante.
+   * @return Scalar y-coordiante.
    */
-  double y(const int index) const { return m_y(index); }
+  Scalar y(const int index) const { return m_y(index); }
 
   /**
    * @brief Get x-coordinates along the point sequence.
@@ -75,6 +336,31 @@ public:
    */
   const ArrayPoints &y() const { return m_y; }
 
+  /**
+   * @brief Get modifiable x-coordinates along the point sequence.
+   *
+   * @return ArrayPoints& x-coordinates.
+   */
+  ArrayPoints &x() { return m_x; }
+
+  /**
+   * @brief Get modifiable y-coordinates along the point sequence.
+   *
+   * @return ArrayPoints& y-coordinates.
+   */
+  ArrayPoints &y() { return m_y; }
+
+  /**
+   * @brief Resize the point sequence. Coordinates are uninitialized if the
+   * number of points changes and kept otherwise without reallocation.
+   *
+   * @param numPoints new number of points.
+   */
+  void resize(int numPoints) {
+    m_x.resize(numPoints);
+    m_y.resize(numPoints);
+  }
+
   void setX(const ArrayPoints &x) { m_x = x; }
 
   void setY(const ArrayPoints &y) { m_y = y; }
@@ -99,139 +385,160 @@ public:
     return distanceSquare(point).sqrt();
   }
 
-  /**
-   * @brief Negate x- and y-coordinates.
-   *
-   * @return Points with negated x- and y-coordinates.
-   */
-  Points operator-() const { return {-m_x, -m_y}; }
+private:
+  ArrayPoints m_x{}; /**<< x-coordinates of the Point sequence */
+  ArrayPoints m_y{}; /**<< y-coordinates of the Point sequence */
+};
 
-  /**
-   * @brief Element-wise sum of two Points.
-   *
-   * @param points1 first Points sequence of the sum.
-   * @param points2 second Points sequence of the sum.
-   * @return Points<NumPoints, PointType> with sum of coordinates of "points1"
-   * and "points2".
-   */
-  friend Points<NumPoints, PointType>
-  operator+(const Points<NumPoints, PointType> &points1,
-            const Points<NumPoints, PointType> &points2) {
-    return {points1.m_x + points2.m_x, points1.m_y + points2.m_y};
-  }
+/**
+ * @brief Negate x- and y-coordinates.
+ *
+ * @param points Points to negate.
+ * @return PointsExpression with negated x- and y-coordinates.
+ */
+template <Internal::PointsSequence Sequence> auto operator-(Sequence &&points) {
+  return Internal::makeExpression<Internal::CoordinateWise<std::negate<>>,
+                                  Internal::PointTypeOf<Sequence>>(
+      std::forward<Sequence>(points));
+}
 
-  /**
-   * @brief Element-wise sum of Points and Point.
-   *
-   * @param points Points involved in the sum.
-   * @param point Point involved in the sum.
-   * @return Points<NumPoints, PointType> with sum of coordinates in "point" and
-   * "points".
-   */
-  friend Points<NumPoints, PointType>
-  operator+(const Points<NumPoints, PointType> &points,
-            const PointType &point) {
-    return {points.m_x + point.x(), points.m_y + point.y()};
-  }
+/**
+ * @brief Element-wise sum of two Points.
+ *
+ * @param points1 first Points sequence of the sum.
+ * @param points2 second Points sequence of the sum.
+ * @return PointsExpression with sum of coordinates of "points1" and "points2".
+ */
+template <Internal::PointsSequence Sequence1,
+          Internal::PointsSequence Sequence2>
+auto operator+(Sequence1 &&points1, Sequence2 &&points2) {
+  return Internal::makeExpression<Internal::CoordinateWise<std::plus<>>,
+                                  Internal::PointTypeOf<Sequence1>>(
+      std::forward<Sequence1>(points1), std::forward<Sequence2>(points2));
+}
 
-  /**
-   * @brief Element-wise sum of Point and Points.
-   *
-   * @param point Point involved in the sum.
-   * @param points Points involved in the sum.
-   * @return Points<NumPoints, PointType> with sum of coordinates in "point" and
-   * "points".
-   */
-  friend Points<NumPoints, PointType>
-  operator+(const PointType &point,
-            const Points<NumPoints, PointType> &points) {
-    return points + point;
-  }
+/**
+ * @brief Element-wise sum of Points and Point.
+ *
+ * @param points Points involved in the sum.
+ * @param point Point involved in the sum.
+ * @return PointsExpression with sum of coordinates in "point" and "points".
+ */
+template <Internal::PointsSequence Sequence>
+auto operator+(Sequence &&points,
+               const Internal::PointTypeOf<Sequence> &point) {
+  return Internal::makeExpression<Internal::CoordinateWise<std::plus<>>,
+                                  Internal::PointTypeOf<Sequence>>(
+      std::forward<Sequence>(points), Internal::PointTypeOf<Sequence>{point});
+}
 
-  /**
-   * @brief Element-wise difference between two Points.
-   *
-   * @param points1 first Points sequence of the difference.
-   * @param points2 second Points sequence of the difference.
-   * @return Points<NumPoints, PointType> with difference between coordinates of
-   * "points1" and "points2".
-   */
-  friend Points<NumPoints, PointType>
-  operator-(const Points<NumPoints, PointType> &points1,
-            const Points<NumPoints, PointType> &points2) {
-    return -points2 + points1;
-  }
+/**
+ * @brief Element-wise sum of Point and Points.
+ *
+ * @param point Point involved in the sum.
+ * @param points Points involved in the sum.
+ * @return PointsExpression with sum of coordinates in "point" and "points".
+ */
+template <Internal::PointsSequence Sequence>
+auto operator+(const Internal::PointTypeOf<Sequence> &point,
+               Sequence &&points) {
+  return std::forward<Sequence>(points) + point;
+}
 
-  /**
-   * @brief Element-wise difference between Points and Point.
-   *
-   * @param points Points involved in the difference.
-   * @param point Point involved in the difference.
-   * @return Points<NumPoints, PointType> with difference between coordinates in
-   * "points" and "point".
-   */
-  friend Points<NumPoints, PointType>
-  operator-(const Points<NumPoints, PointType> &points,
-            const PointType &point) {
-    return -point + points;
-  }
+/**
+ * @brief Element-wise difference between two Points.
+ *
+ * @param points1 first Points sequence of the difference.
+ * @param points2 second Points sequence of the difference.
+ * @return PointsExpression with difference between coordinates of "points1"
+ * and "points2".
+ */
+template <Internal::PointsSequence Sequence1,
+          Internal::PointsSequence Sequence2>
+auto operator-(Sequence1 &&points1, Sequence2 &&points2) {
+  return Internal::makeExpression<Internal::CoordinateWise<std::minus<>>,
+                                  Internal::PointTypeOf<Sequence1>>(
+      std::forward<Sequence1>(points1), std::forward<Sequence2>(points2));
+}
 
-  /**
-   * @brief Element-wise difference between Point and Points.
-   *
-   * @param point Point involved in the difference.
-   * @param points Points involved in the difference.
-   * @return Points<NumPoints, PointType> with difference between coordinates in
-   * "point" and "points".
-   */
-  friend Points<NumPoints, PointType>
-  operator-(const PointType &point,
-            const Points<NumPoints, PointType> &points) {
-    return -points + point;
-  }
+/**
+ * @brief Element-wise difference between Points and Point.
+ *
+ * @param points Points involved in the difference.
+ * @param point Point involved in the difference.
+ * @return PointsExpression with difference between coordinates in "points"
+ * and "point".
+ */
+template <Internal::PointsSequence Sequence>
+auto operator-(Sequence &&points,
+               const Internal::PointTypeOf<Sequence> &point) {
+  return Internal::makeExpression<Internal::CoordinateWise<std::minus<>>,
+                                  Internal::PointTypeOf<Sequence>>(
+      std::forward<Sequence>(points), Internal::PointTypeOf<Sequence>{point});
+}
 
-  /**
-   * @brief Element-wise scalar product of two Points.
-   *
-   * @param points1 first Points involved in the product.
-   * @param points2 second Points involved in the product.
-   * @return ArrayPoints scalar products of "points1" and "points2".
-   */
-  friend ArrayPoints operator*(const Points<NumPoints, PointType> &points1,
-                               const Points<NumPoints, PointType> &points2) {
-    return points1.m_x * points2.m_x + points1.m_y * points2.m_y;
-  }
+/**
+ * @brief Element-wise difference between Point and Points.
+ *
+ * @param point Point involved in the difference.
+ * @param points Points involved in the difference.
+ * @return PointsExpression with difference between coordinates in "point"
+ * and "points".
+ */
+template <Internal::PointsSequence Sequence>
+auto operator-(const Internal::PointTypeOf<Sequence> &point,
+               Sequence &&points) {
+  return Internal::makeExpression<Internal::CoordinateWise<std::minus<>>,
+                                  Internal::PointTypeOf<Sequence>>(
+      Internal::PointTypeOf<Sequence>{point}, std::forward<Sequence>(points));
+}
 
-  /**
-   * @brief Element-wise product of Points and scalars.
-   *
-   * @param points Points involved in the product.
-   * @param nums scalars invovled in the product.
-   * @return Points<NumPoints, PointType> products of "points" and "nums".
-   */
-  friend Points<NumPoints, PointType>
-  operator*(const Points<NumPoints, PointType> &points,
-            const ArrayPoints &nums) {
-    return {points.m_x * nums, points.m_y * nums};
-  }
+/**
+ * @brief Element-wise scalar product of two Points. Products of lvalues stay
+ * lazy, products involving temporaries are evaluated, since Eigen
+ * expressions cannot hold them.
+ *
+ * @param points1 first Points involved in the product.
+ * @param points2 second Points involved in the product.
+ * @return Eigen expression or array of the scalar products of "points1" and
+ * "points2".
+ */
+template <Internal::PointsSequence Sequence1,
+          Internal::PointsSequence Sequence2>
+auto operator*(Sequence1 &&points1, Sequence2 &&points2) {
+  auto products{points1.x() * points2.x() + points1.y() * points2.y()};
+  if constexpr (std::is_lvalue_reference_v<Sequence1> &&
+                std::is_lvalue_reference_v<Sequence2>)
+    return products;
+  else
+    return products.eval();
+}
 
-  /**
-   * @brief Element-wise product of scalars and Points.
-   *
-   * @param nums scalars invovled in the product.
-   * @param points Points involved in the product.
-   * @return Points<NumPoints, PointType> products of "points" and "nums".
-   */
-  friend Points<NumPoints, PointType>
-  operator*(const ArrayPoints &nums,
-            const Points<NumPoints, PointType> &points) {
-    return points * nums;
-  }
+/**
+ * @brief Element-wise product of Points and scalars.
+ *
+ * @param points Points involved in the product.
+ * @param nums scalars invovled in the product.
+ * @return PointsExpression with products of "points" and "nums".
+ */
+template <Internal::PointsSequence Sequence, Internal::ArraySequence Array>
+auto operator*(Sequence &&points, Array &&nums) {
+  return Internal::makeExpression<Internal::CoordinateWise<std::multiplies<>>,
+                                  Internal::PointTypeOf<Sequence>>(
+      std::forward<Sequence>(points), std::forward<Array>(nums));
+}
 
-private:
-  ArrayPoints m_x{}; /**<< x-coordinates of the Point sequence */
-  ArrayPoints m_y{}; /**<< y-coordinates of the Point sequence */
-};
+/**
+ * @brief Element-wise product of scalars and Points.
+ *
+ * @param nums scalars invovled in the product.
+ * @param points Points involved in the product.
+ * @return PointsExpression with products of "points" and "nums".
+ */
+template <Internal::ArraySequence Array, Internal::PointsSequence Sequence>
+auto operator*(Array &&nums, Sequence &&points) {
+  return std::forward<Sequence>(points) * std::forward<Array>(nums);
+}
 }; // namespace FrenetTransform
 
 #endif
\ No newline at end of file
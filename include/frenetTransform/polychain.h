@@ -1,29 +1,60 @@
 #ifndef polychain_H
 #define polychain_H
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
 #include <math.h>
+#include <utility>
+#include <vector>
 
 #include "frenetTransform/internal/math.h"
+#include "frenetTransform/internal/segmentCoarse.h"
+#include "frenetTransform/internal/segmentGrid.h"
+#include "frenetTransform/internal/segmentRaster.h"
+#include "frenetTransform/internal/segmentTree.h"
+#include "frenetTransform/frames.h"
 #include "frenetTransform/path.h"
 #include "frenetTransform/point.h"
 #include "frenetTransform/points.h"
 
 namespace FrenetTransform {
+/**
+ * @brief Strategies to search the polychain segment closest to a query point.
+ *
+ */
+enum class Search {
+  Linear, /**<< linear search over all segments */
+  Tree,   /**<< search in a bounding volume hierarchy over the segments */
+  Grid,   /**<< search in a uniform grid over the segments */
+  Coarse, /**<< search refining a decimated level of the segments */
+  Auto,   /**<< strategy of least cost estimated from sampled query points */
+};
+
 /**
  * @brief Path representation as polychain.
  * Represents a 2-dimensional path as a polychain.
  * Provide path properties based on finite differences at query points.
  *
+ * The polychain points, lengths and gradients as well as the segment search
+ * are kept in double precision for any Scalar of the queries. Query points are
+ * widened to double for the search and results are rounded to Scalar once,
+ * such that Scalar only trades the precision of the results for throughput of
+ * the queries.
  *
  * @tparam NumPoints number of points along the path with -1 for dynamic point
  * number.
  * @tparam NumQueries number of query points with -1 for dynamic point number.
+ * @tparam Scalar floating point type of the query points and properties.
  */
-template <int NumPoints, int NumQueries = Eigen::Dynamic>
-class Polychain : public Path<NumQueries> {
+template <int NumPoints, int NumQueries = Eigen::Dynamic,
+          typename Scalar = double>
+class Polychain : public Path<NumQueries, Scalar> {
 public:
   using ArrayPoints = Eigen::Array<double, NumPoints, 1>;
-  using ArrayQueries = Eigen::Array<double, NumQueries, 1>;
+  using ArrayQueries = Eigen::Array<Scalar, NumQueries, 1>;
+  using PointsQueries = Points<NumQueries, BasicPoint<Scalar>>;
 
   Polychain() = default;
 
@@ -32,16 +63,23 @@ public:
    *
    * @param x coordinates in x-direction along the path.
    * @param y coordinates in y-direction along the path.
+   * @param search strategy to search the segments closest to query points.
    */
-  Polychain(const ArrayPoints &x, const ArrayPoints &y) { setPoints(x, y); }
+  Polychain(const ArrayPoints &x, const ArrayPoints &y,
+            Search search = Search::Linear)
+      : m_search{search} {
+    setPoints(x, y);
+  }
 
   /**
    * @brief Construct a new Polychain object from points in Cartesian
    * coordinates.
    *
    * @param points points along the path.
+   * @param search strategy to search the segments closest to query points.
    */
-  Polychain(const Points<NumPoints> &points) {
+  Polychain(const Points<NumPoints> &points, Search search = Search::Linear)
+      : m_search{search} {
     setPoints(points.x(), points.y());
   }
 
@@ -51,100 +89,225 @@ public:
    * last point.
    *
    * @param lengths query lengths along the polychain.
-   * @return Points<NumQueries> at the query lengths.
+   * @return PointsQueries at the query lengths.
    */
-  Points<NumQueries> operator()(const ArrayQueries &lengths) const override {
-    // indices of corresponding polychain segments
-    Eigen::Array<int, NumQueries, 1> indicesLengths{indices(lengths)};
-    for (int &idx : indicesLengths)
-      idx = idx > 0 ? idx - 1 : idx;
+  PointsQueries operator()(const ArrayQueries &lengths) const final {
+    PointsQueries result{};
+    result.resize(lengths.rows());
+    forEachSegment(lengths, [this, &lengths, &result](int row, int index) {
+      const Point point{pointAt(lengths(row), index)};
+      result.x()(row) = point.x();
+      result.y()(row) = point.y();
+    });
+    return result;
+  }
 
-    // relative position along the linear segment
-    const ArrayPoints pathLengthsdiff{diffBackward(m_lengths)};
-    ArrayQueries segmentPart{(lengths - m_lengths(indicesLengths)) /
-                             pathLengthsdiff(indicesLengths + 1)};
-    for (double &part : segmentPart)
-      part = std::clamp(part, 0.0, 1.0);
+  /**
+   * @brief Determines the Frenet frames at the given path lengths in a single
+   * pass. Resolves the polychain segments of the lengths only once for all
+   * requested properties.
+   *
+   * @param lengths lengths along the path.
+   * @param properties mask of FrameProperty values to determine.
+   * @return Frames<NumQueries, Scalar> frames with the requested properties.
+   */
+  Frames<NumQueries, Scalar>
+  frames(const ArrayQueries &lengths,
+         unsigned int properties = FrameAll) const final {
+    Frames<NumQueries, Scalar> result{};
+    frames(lengths, properties, result);
+    return result;
+  }
 
-    // absolute position along path
-    ArrayQueries x{m_points[0].x()(indicesLengths + 1) * segmentPart +
-                   m_points[0].x()(indicesLengths) * (1 - segmentPart)};
-    ArrayQueries y{m_points[0].y()(indicesLengths + 1) * segmentPart +
-                   m_points[0].y()(indicesLengths) * (1 - segmentPart)};
+  /**
+   * @brief Determines the Frenet frames at the given path lengths into
+   * caller-provided frames without allocation if their sizes match the
+   * lengths. Evaluates all requested properties of a query in one step.
+   * Properties not requested remain unchanged.
+   *
+   * @param lengths lengths along the path.
+   * @param properties mask of FrameProperty values to determine.
+   * @param result frames with the requested properties.
+   */
+  void frames(const ArrayQueries &lengths, unsigned int properties,
+              Frames<NumQueries, Scalar> &result) const final {
+    const int numQueries{static_cast<int>(lengths.rows())};
+    if (properties & FramePoints)
+      result.points.resize(numQueries);
+    if (properties & FrameTangents) {
+      result.tangents.resize(numQueries);
+      result.normals.resize(numQueries);
+    }
+    if (properties & FrameCurvatures)
+      result.curvatures.resize(numQueries);
+    if (properties & FrameCurvatureRates)
+      result.curvatureRates.resize(numQueries);
 
-    return {x, y};
+    forEachSegment(lengths, [this, &lengths, properties, &result](int row,
+                                                                  int index) {
+      const Frame<Scalar> frame{frameAt(lengths(row), index, properties)};
+      if (properties & FramePoints) {
+        result.points.x()(row) = frame.point.x();
+        result.points.y()(row) = frame.point.y();
+      }
+      if (properties & FrameTangents) {
+        result.tangents.x()(row) = frame.tangent.x();
+        result.tangents.y()(row) = frame.tangent.y();
+        result.normals.x()(row) = frame.normal.x();
+        result.normals.y()(row) = frame.normal.y();
+      }
+      if (properties & FrameCurvatures)
+        result.curvatures(row) = frame.curvature;
+      if (properties & FrameCurvatureRates)
+        result.curvatureRates(row) = frame.curvatureRate;
+    });
+  }
+
+  /**
+   * @brief Determines the Frenet frame at a single path length without
+   * arrays or allocation. Starts the segment search at the bucket of the
+   * length if buckets are available.
+   *
+   * @param length length along the path.
+   * @param properties mask of FrameProperty values to determine.
+   * @return Frame<Scalar> frame with the requested properties.
+   */
+  Frame<Scalar> frame(Scalar length,
+                      unsigned int properties = FrameAll) const final {
+    return frameAt(
+        length,
+        FrenetTransform::firstSorted(m_lengths, length, lookup(length)),
+        properties);
   }
 
   /**
    * @brief Determines next points to the query points.
-   * Performs a linear search over all polychain segments to identify the
-   * closest one.
+   * Searches the closest polychain segment with the selected Search strategy.
+   * All strategies provide the lengths of a linear search over all segments.
+   *
+   * @param points query points.
+   * @return ArrayQueries lengths next to query points.
+   */
+  ArrayQueries lengths(const PointsQueries &points) const final {
+    ArrayQueries result{};
+    lengths(points, result);
+    return result;
+  }
+
+  /**
+   * @brief Determines next points to the query points into caller-provided
+   * lengths without allocation if their size matches the query points.
    *
    * @param points query points.
-   * @return Points<NumQueries> next points to query points.
+   * @param lengthsPoints lengths next to query points.
    */
-  ArrayQueries lengths(const Points<NumQueries> &points) const override {
-    ArrayQueries lengthsPoints(points.numPoints());
+  void lengths(const PointsQueries &points,
+               ArrayQueries &lengthsPoints) const final {
+    lengthsPoints.resize(points.numPoints());
 
-    // determine lengths for all query points
-    for (int cQuery{}; cQuery < points.numPoints(); ++cQuery) {
-      // current minimum squared distance between query point and polychain
-      double distanceSquare{-1.0};
-
-      // determine distance between query point and path segment
-      for (int cPoints{1}; cPoints < m_numPoints; ++cPoints) {
-        // point at end of current segment
-        const Point nextPoint{m_points[0](cPoints)};
-        // difference between "nextPoint" and query point
-        const Point diffPoint{nextPoint - points(cQuery)};
-        // parameter determining next point along current linear segment
-        const double segmentPart{(diffPoint.x() * m_xDiff(cPoints) +
-                                  diffPoint.y() * m_yDiff(cPoints)) /
-                                 m_diffSquare(cPoints)};
-
-        // squared distance between current segment and query point
-        double distanceSquareCand{};
-        // length along polychain of shortest distance point on segment to query
-        // point
-        double lengthCand{};
-
-        // determine squared distance and length if shortest distance point is
-        // beyond segment end
-        if (segmentPart >= 1.0) {
-          distanceSquareCand =
-              m_points[0](cPoints - 1).distanceSquare(points(cQuery));
-          lengthCand = m_lengths.data()[cPoints - 1];
-        }
-        // determine squared distance and length if shortest distance point is
-        // beyond segment start
-        else if (segmentPart <= 0.0) {
-          distanceSquareCand =
-              m_points[0](cPoints).distanceSquare(points(cQuery));
-          lengthCand = m_lengths.data()[cPoints];
-        }
-        // determine squared distance and length if shortest distance point is
-        // on segment
-        else {
-          // point at start of current segment
-          const Point prevPoint{m_points[0](cPoints - 1)};
-          // shortest distance point on current segment
-          const Point pointCand{
-              prevPoint.x() * segmentPart + (1 - segmentPart) * nextPoint.x(),
-              prevPoint.y() * segmentPart + (1 - segmentPart) * nextPoint.y()};
-          distanceSquareCand = points(cQuery).distanceSquare(pointCand);
-          lengthCand = m_lengths(cPoints - 1) + pointCand.distance(prevPoint);
-        }
-
-        // update length and squared distance if squared distance is smaller
-        // than current minimum
-        if (distanceSquareCand < distanceSquare || distanceSquare < 0) {
-          distanceSquare = distanceSquareCand;
-          lengthsPoints(cQuery) = lengthCand;
-        }
+    // automatic strategy searches samples spread over the query points with
+    // the tree and continues with the strategy of least estimated cost
+    Search search{m_search};
+    std::array<int, s_autoSamples> samples{};
+    const int numSamples{search == Search::Auto && !m_tree.empty()
+                             ? std::min(points.numPoints(), s_autoSamples)
+                             : 0};
+    if (numSamples > 0) {
+      double candidates{};
+      double costCoarse{};
+      double distance{};
+      for (int cSample{}; cSample < numSamples; ++cSample) {
+        samples[cSample] =
+            (2 * cSample + 1) * points.numPoints() / (2 * numSamples);
+        const Point point{points(samples[cSample])};
+        const Nearest sample{nearest(point, Search::Tree, candidates)};
+        lengthsPoints(samples[cSample]) = sample.length;
+        distance += std::sqrt(sample.distanceSquare);
+        // coarse samples only pay off if query points remain
+        if (points.numPoints() > numSamples)
+          nearest(point, Search::Coarse, costCoarse);
       }
+      search = points.numPoints() > numSamples
+                   ? autoSearch(candidates / numSamples,
+                                costCoarse / numSamples, distance / numSamples)
+                   : Search::Tree;
     }
 
-    return lengthsPoints;
+    // determine lengths for all remaining query points
+    double cost{};
+    for (int cQuery{}, cSample{}; cQuery < points.numPoints(); ++cQuery) {
+      if (cSample < numSamples && cQuery == samples[cSample]) {
+        ++cSample;
+        continue;
+      }
+      lengthsPoints(cQuery) =
+          nearest(Point{points(cQuery)}, search, cost).length;
+    }
+  }
+
+  /**
+   * @brief Determines next points to the query points close to previous
+   * lengths. Only searches the segments within "window" around the hints. Falls
+   * back to the selected Search strategy if the closest segment is at the
+   * window edge or the hint is not finite.
+   *
+   * @param points query points.
+   * @param hints previous lengths along the polychain for each query point.
+   * @param window maximum length difference to the hints searched locally.
+   * @return ArrayQueries lengths next to query points.
+   */
+  ArrayQueries lengths(const PointsQueries &points, const ArrayQueries &hints,
+                       Scalar window) const final {
+    ArrayQueries result{};
+    lengths(points, hints, window, result);
+    return result;
+  }
+
+  /**
+   * @brief Determines next points to the query points close to previous
+   * lengths into caller-provided lengths without allocation if their size
+   * matches the query points.
+   *
+   * @param points query points.
+   * @param hints previous lengths along the polychain for each query point.
+   * @param window maximum length difference to the hints searched locally.
+   * @param lengthsPoints lengths next to query points.
+   */
+  void lengths(const PointsQueries &points, const ArrayQueries &hints,
+               Scalar window, ArrayQueries &lengthsPoints) const final {
+    lengthsPoints.resize(points.numPoints());
+
+    // determine lengths for all query points
+    for (int cQuery{}; cQuery < points.numPoints(); ++cQuery)
+      lengthsPoints(cQuery) =
+          nearest(Point{points(cQuery)}, hints(cQuery), window).length;
+  }
+
+  /**
+   * @brief Determines the next point to a single query point without arrays
+   * or allocation. Searches the closest polychain segment with the selected
+   * Search strategy.
+   *
+   * @param point query point.
+   * @return Scalar length next to the query point.
+   */
+  Scalar length(const BasicPoint<Scalar> &point) const final {
+    return nearest(Point{point}).length;
+  }
+
+  /**
+   * @brief Determines the next point to a single query point close to a
+   * previous length without arrays or allocation. Only searches the segments
+   * within "window" around the hint if the closest segment is inside.
+   *
+   * @param point query point.
+   * @param hint previous length along the polychain.
+   * @param window maximum length difference to the hint searched locally.
+   * @return Scalar length next to the query point.
+   */
+  Scalar length(const BasicPoint<Scalar> &point, Scalar hint,
+                Scalar window) const final {
+    return nearest(Point{point}, hint, window).length;
   }
 
   /**
@@ -170,16 +333,133 @@ public:
     // accumulated lengths along the new points
     m_lengths = FrenetTransform::partialLength(x, y);
 
+    // scale of rounding errors in projections
+    m_coordinateMax =
+        m_numPoints > 0 ? std::max(x.abs().maxCoeff(), y.abs().maxCoeff())
+                        : 0.0;
+
     // update gradients
     for (unsigned int orderGrad{1}; orderGrad < s_numGrad; ++orderGrad)
       m_points[orderGrad] = Points<NumPoints>{
           FrenetTransform::gradient(m_points[orderGrad - 1].x(), m_lengths),
           FrenetTransform::gradient(m_points[orderGrad - 1].y(), m_lengths)};
+
+    // update search structures
+    buildSearch();
+    buildLookup();
+    buildRaster();
+  }
+
+  /**
+   * @brief Select the strategy to search the segments closest to query points.
+   * Builds the required search structures. The Auto strategy builds the tree,
+   * the grid and the decimated level for polychains with more than
+   * "s_autoSegmentsLinear" segments and searches smaller ones linearly.
+   *
+   * @param search strategy to search the closest segments.
+   */
+  void setSearch(Search search) {
+    m_search = search;
+    buildSearch();
+  }
+
+  /**
+   * @brief Provides the strategy to search the segments closest to query
+   * points.
+   *
+   * @return Search strategy to search the closest segments.
+   */
+  Search search() const { return m_search; }
+
+  /**
+   * @brief Set the number of segments per segment of the decimated level used
+   * by the Coarse search strategy. Rebuilds the decimated level if selected.
+   *
+   * @param stride number of segments per coarse segment, zero or negative for
+   * the square root of the number of segments.
+   */
+  void setCoarseStride(int stride) {
+    m_coarseStride = std::max(stride, 0);
+    buildSearch();
+  }
+
+  /**
+   * @brief Provides the number of segments per segment of the decimated level.
+   *
+   * @return int number of segments per coarse segment, zero if automatic.
+   */
+  int coarseStride() const { return m_coarseStride; }
+
+  /**
+   * @brief Bucket the segment indices at lengths with fixed "spacing".
+   * Query lengths start their segment search at the bucket of their length
+   * instead of bisecting all lengths. Spacings not exceeding the shortest
+   * segment resolve each length with at most one correction step. Requires
+   * about total length / "spacing" indices of memory.
+   *
+   * @param spacing length between buckets, zero or negative to disable.
+   */
+  void setLookup(double spacing) {
+    m_lookupSpacing = std::max(spacing, 0.0);
+    buildLookup();
+  }
+
+  /**
+   * @brief Provides the length between buckets of segment indices.
+   *
+   * @return double length between buckets, zero if disabled.
+   */
+  double lookupSpacing() const { return m_lookupSpacing; }
+
+  /**
+   * @brief Precompute the candidate segments closest to each cell of a raster
+   * over the region between "lower" and "upper" corner.
+   * Query points inside the region only project onto the candidates of their
+   * cell, others use the selected Search strategy. The candidates include all
+   * segments possibly closest to any point in the cell, such that the lengths
+   * equal the ones of a linear search.
+   *
+   * @param lower corner of the region with minimum coordinates.
+   * @param upper corner of the region with maximum coordinates.
+   * @param resolution side length of the raster cells, zero or negative to
+   * disable.
+   */
+  void setRaster(const Point &lower, const Point &upper, double resolution) {
+    m_rasterLower = lower;
+    m_rasterUpper = upper;
+    m_rasterResolution = std::max(resolution, 0.0);
+    buildRaster();
   }
 
 private:
+  /**
+   * @brief Closest point on the polychain to a query point.
+   *
+   */
+  struct Nearest {
+    // squared distance between query point and polychain
+    double distanceSquare{std::numeric_limits<double>::infinity()};
+    double length{}; /**<< length along the polychain */
+    int segment{};   /**<< index of the segment end point */
+  };
+
   int m_numPoints{}; /*<< number of points along the polychain*/
 
+  Search m_search{Search::Linear}; /*<< strategy to search closest segments*/
+  Internal::SegmentTree m_tree{};  /*<< bounding volume hierarchy of segments*/
+  Internal::SegmentGrid m_grid{};  /*<< uniform grid over segments*/
+
+  int m_coarseStride{};               /*<< segments per coarse segment*/
+  Internal::SegmentCoarse m_coarse{}; /*<< decimated level of segments*/
+
+  double m_lookupSpacing{};    /*<< length between buckets of m_lookup*/
+  std::vector<int> m_lookup{}; /*<< index of first point in each bucket*/
+
+  Point m_rasterLower{};              /*<< lower corner of raster region*/
+  Point m_rasterUpper{};              /*<< upper corner of raster region*/
+  double m_rasterResolution{};        /*<< side length of raster cells*/
+  Internal::SegmentRaster m_raster{}; /*<< candidate segments per cell*/
+
   ArrayPoints m_lengths{}; /*<< partial lengths along polychain*/
 
   ArrayPoints
@@ -189,21 +469,450 @@ private:
   ArrayPoints
       m_diffSquare{}; /*<< differences between polychain points squared*/
 
+  double m_coordinateMax{}; /*<< maximum absolute coordinate of points*/
+
   static constexpr int s_numGrad{4}; /*<< number of time derivatives provided*/
+  static constexpr int s_kernelWidth{
+      256}; /*<< maximum number of segments projected at once*/
+  static constexpr double s_kernelSlack{
+      64 * std::numeric_limits<double>::epsilon()}; /*<< relative slack*/
+  static constexpr int s_autoSegmentsLinear{
+      32}; /*<< maximum segments always searched linearly*/
+  static constexpr int s_autoSamples{
+      8}; /*<< query points sampling the search costs*/
+  static constexpr int s_autoPasses{
+      2}; /*<< bound evaluations per coarse segment*/
+  static constexpr double s_autoCostCoarse{
+      2.0}; /*<< cost of coarse relative to fine segments*/
+  static constexpr double s_autoCostSingle{
+      4.0}; /*<< cost of single relative to block projected segments*/
+  static constexpr double s_autoCostNode{
+      4.0}; /*<< cost of tree levels relative to fine segments*/
+  static constexpr double s_autoCostCell{
+      0.5}; /*<< cost of grid cells relative to fine segments*/
+  static constexpr double s_rasterSlack{
+      1e-9}; /*<< relative slack of squared raster candidate distances*/
   std::array<Points<NumPoints>, s_numGrad>
       m_points{}; /*<< points and gradients at polychain points*/
 
+  /**
+   * @brief Builds the search structures required by the selected strategy.
+   *
+   */
+  void buildSearch() {
+    // automatic strategy searches small polychains linearly
+    const bool autoIndexed{m_search == Search::Auto &&
+                           m_numPoints - 1 > s_autoSegmentsLinear};
+
+    m_tree = m_search == Search::Tree || autoIndexed
+                 ? Internal::SegmentTree{m_points[0].x(), m_points[0].y()}
+                 : Internal::SegmentTree{};
+
+    m_grid = m_search == Search::Grid || autoIndexed
+                 ? Internal::SegmentGrid{m_points[0].x(), m_points[0].y(),
+                                         segmentLengthMedian()}
+                 : Internal::SegmentGrid{};
+
+    // stride balancing the number of coarse and refined fine segments
+    const int coarseStride{
+        m_coarseStride > 0
+            ? m_coarseStride
+            : static_cast<int>(std::sqrt(std::max(m_numPoints - 1, 1)))};
+    m_coarse = m_search == Search::Coarse || autoIndexed
+                   ? Internal::SegmentCoarse{m_points[0].x(), m_points[0].y(),
+                                             coarseStride}
+                   : Internal::SegmentCoarse{};
+  }
+
+  /**
+   * @brief Builds the buckets of segment indices at fixed spacing.
+   *
+   */
+  void buildLookup() {
+    m_lookup.clear();
+    if (m_lookupSpacing <= 0.0 || m_numPoints < 1)
+      return;
+
+    const int numBuckets{
+        static_cast<int>(m_lengths(m_numPoints - 1) / m_lookupSpacing) + 1};
+    m_lookup.resize(numBuckets);
+
+    // walk along the polychain to the first point of each bucket
+    int index{};
+    for (int bucket{}; bucket < numBuckets; ++bucket) {
+      index = FrenetTransform::firstSorted(m_lengths, bucket * m_lookupSpacing,
+                                           index);
+      m_lookup[bucket] = index;
+    }
+  }
+
+  /**
+   * @brief Provides the index of the first point in the bucket containing the
+   * given length. All points before have smaller lengths.
+   *
+   * @param length length along the polychain.
+   * @return int index to start the segment search from.
+   */
+  int lookup(double length) const {
+    if (m_lookup.empty() || !(length >= 0.0))
+      return 0;
+
+    const double bucket{std::min(length / m_lookupSpacing,
+                                 static_cast<double>(m_lookup.size() - 1))};
+    int start{m_lookup[static_cast<int>(bucket)]};
+
+    // division may round up to the bucket of the next larger lengths
+    while (start > 0 && !(m_lengths(start - 1) < length))
+      --start;
+    return start;
+  }
+
+  /**
+   * @brief Builds the raster of candidate segments per cell.
+   * The distance of any point in a cell to the polychain is bounded by the
+   * largest distance between a cell corner and the segment closest to the cell
+   * center. Candidates are all segments within this bound to the cell.
+   *
+   */
+  void buildRaster() {
+    m_raster = {};
+    if (m_rasterResolution <= 0.0 || m_numPoints < 2)
+      return;
+
+    const Internal::SegmentTree tree{m_points[0].x(), m_points[0].y()};
+    m_raster = Internal::SegmentRaster{
+        m_rasterLower, m_rasterUpper, m_rasterResolution,
+        [this, &tree](const Internal::Box &cell, std::vector<int> &segments) {
+          // closest segment to the cell center
+          const Point center{(cell.xMin + cell.xMax) / 2,
+                             (cell.yMin + cell.yMax) / 2};
+          Nearest centerNearest{};
+          tree.nearest(center, [this, &center, &centerNearest](int cPoints) {
+            project(cPoints, center, centerNearest);
+            return centerNearest.distanceSquare;
+          });
+          segments.push_back(centerNearest.segment);
+
+          // bound distance of all points in the cell to the polychain
+          double boundSquare{};
+          for (const Point &corner :
+               {Point{cell.xMin, cell.yMin}, Point{cell.xMax, cell.yMin},
+                Point{cell.xMin, cell.yMax}, Point{cell.xMax, cell.yMax}}) {
+            Nearest cornerNearest{};
+            project(centerNearest.segment, corner, cornerNearest);
+            boundSquare = std::max(boundSquare, cornerNearest.distanceSquare);
+          }
+          boundSquare *= 1 + s_rasterSlack;
+
+          // all segments within the bound to the cell
+          const double reach{
+              std::sqrt(boundSquare) +
+              std::hypot(cell.xMax - cell.xMin, cell.yMax - cell.yMin) / 2};
+          tree.nearest(
+              center,
+              [this, &cell, &segments, &centerNearest, boundSquare,
+               reach](int cPoints) {
+                if (cPoints != centerNearest.segment &&
+                    cell.distanceSquare(m_points[0](cPoints - 1),
+                                        m_points[0](cPoints)) <= boundSquare)
+                  segments.push_back(cPoints);
+                return reach * reach;
+              },
+              reach * reach);
+        }};
+  }
+
+  /**
+   * @brief Provides the median length of the polychain segments.
+   *
+   * @return double median segment length.
+   */
+  double segmentLengthMedian() const {
+    if (m_numPoints < 2)
+      return 0.0;
+
+    std::vector<double> lengthsSquare(m_diffSquare.data() + 1,
+                                      m_diffSquare.data() + m_numPoints);
+    const auto median{lengthsSquare.begin() + lengthsSquare.size() / 2};
+    std::nth_element(lengthsSquare.begin(), median, lengthsSquare.end());
+    return std::sqrt(*median);
+  }
+
+  /**
+   * @brief Selects the strategy of least estimated cost per query point for
+   * the Auto strategy in units of segments projected onto by a linear search.
+   * Tree and grid project onto single segments, which cost "s_autoCostSingle"
+   * segments of the block projections. The tree adds the cost of its levels
+   * and the grid visits the cells and segments within the distance of the
+   * query points to the polychain.
+   *
+   * @param candidates mean number of segments projected onto by the tree.
+   * @param costCoarse mean cost of the coarse search.
+   * @param distance mean distance between query points and polychain.
+   * @return Search strategy of least estimated cost.
+   */
+  Search autoSearch(double candidates, double costCoarse,
+                    double distance) const {
+    const int numSegments{m_numPoints - 1};
+    const double density{numSegments /
+                         (m_lengths(m_numPoints - 1) - m_lengths(0))};
+    const double cells{2 * distance / m_grid.cellSize() + 1};
+    const std::array<std::pair<Search, double>, 4> costs{
+        {{Search::Linear, static_cast<double>(numSegments)},
+         {Search::Tree, s_autoCostSingle * candidates +
+                            s_autoCostNode * std::log2(numSegments)},
+         {Search::Grid, s_autoCostSingle * (2 * distance * density + 1) +
+                            s_autoCostCell * cells * cells},
+         {Search::Coarse, costCoarse}}};
+
+    return std::min_element(costs.begin(), costs.end(),
+                            [](const auto &lhs, const auto &rhs) {
+                              return lhs.second < rhs.second;
+                            })
+        ->first;
+  }
+
+  /**
+   * @brief Determines the closest point on the polychain to a query point.
+   * Equally distant segments resolve to the one with the smallest index.
+   *
+   * @param point query point.
+   * @return Nearest closest point on the polychain.
+   */
+  Nearest nearest(const Point &point) const {
+    double cost{};
+    return nearest(point, m_search, cost);
+  }
+
+  /**
+   * @brief Determines the closest point on the polychain to a query point with
+   * the given Search strategy and accumulates its cost.
+   *
+   * @param point query point.
+   * @param search strategy to search the closest segment.
+   * @param cost accumulated number of segment projections, where coarse
+   * segments are weighted by their relative cost.
+   * @return Nearest closest point on the polychain.
+   */
+  Nearest nearest(const Point &point, Search search, double &cost) const {
+    Nearest result{};
+
+    // only project onto candidates of raster cell if available
+    if (m_raster.nearest(point, [this, &point, &result, &cost](int cPoints) {
+          project(cPoints, point, result);
+          ++cost;
+        }))
+      return result;
+
+    // single query points do not amortize samples of the search costs
+    if (search == Search::Auto)
+      search = m_tree.empty() ? Search::Linear : Search::Tree;
+
+    switch (search) {
+    case Search::Tree:
+      m_tree.nearest(point, [this, &point, &result, &cost](int cPoints) {
+        project(cPoints, point, result);
+        ++cost;
+        return result.distanceSquare;
+      });
+      break;
+    case Search::Grid:
+      m_grid.nearest(point, [this, &point, &result, &cost](int cPoints) {
+        project(cPoints, point, result);
+        ++cost;
+        return result.distanceSquare;
+      });
+      break;
+    case Search::Coarse:
+      cost += s_autoPasses * m_coarse.size() * s_autoCostCoarse;
+      m_coarse.nearest(
+          point, [this, &point, &result, &cost](int cBegin, int cEnd) {
+            project(cBegin, cEnd, point, result);
+            cost += cEnd - cBegin;
+            return result.distanceSquare;
+          });
+      break;
+    case Search::Linear:
+    case Search::Auto:
+      project(1, m_numPoints, point, result);
+      cost += m_numPoints - 1;
+      break;
+    }
+
+    return result;
+  }
+
+  /**
+   * @brief Determines the closest point on the polychain to a query point
+   * within "window" around the length "hint".
+   *
+   * @param point query point.
+   * @param hint previous length along the polychain.
+   * @param window maximum length difference to "hint" searched locally.
+   * @return Nearest closest point on the polychain.
+   */
+  Nearest nearest(const Point &point, double hint, double window) const {
+    if (m_numPoints < 2 || !std::isfinite(hint))
+      return nearest(point);
+
+    // segments overlapping the window around the hint
+    const int segmentBegin{segment(hint - std::abs(window))};
+    const int segmentEnd{segment(hint + std::abs(window))};
+
+    Nearest result{};
+    project(segmentBegin, segmentEnd + 1, point, result);
+
+    // closest point at window edge may continue beyond the window
+    if ((result.segment == segmentBegin && segmentBegin > 1) ||
+        (result.segment == segmentEnd && segmentEnd < m_numPoints - 1))
+      return nearest(point);
+
+    return result;
+  }
+
+  /**
+   * @brief Determines the segment containing the given length.
+   * Lengths exceeding the polychain's domain resolve to the first or last
+   * segment.
+   *
+   * @param length length along the polychain.
+   * @return int index of the point at the segment end.
+   */
+  int segment(double length) const {
+    return std::clamp(FrenetTransform::firstSorted(m_lengths, length), 1,
+                      m_numPoints - 1);
+  }
+
+  /**
+   * @brief Projects a query point onto the segments "cBegin" to "cEnd"
+   * (exclusive) and updates the closest point.
+   * Blocks of up to "s_kernelWidth" segments are projected branch-free with
+   * vectorizable array operations. Only segments whose block distance lies
+   * within a slack of the block minimum, which covers the rounding differences
+   * between both evaluations, are projected again one at a time. Thus, the
+   * result equals projecting each segment one at a time.
+   *
+   * @param cBegin index of the point at the end of the first segment.
+   * @param cEnd index of the point at the end of the segment after the last.
+   * @param point query point.
+   * @param result closest point found so far, updated in place.
+   */
+  void project(int cBegin, int cEnd, const Point &point,
+               Nearest &result) const {
+    using ArrayKernel = Eigen::Array<double, Eigen::Dynamic, 1, Eigen::ColMajor,
+                                     s_kernelWidth, 1>;
+    using MapKernel = Eigen::Map<const Eigen::ArrayXd>;
+
+    // bound of distance differences between block and single projections
+    const double slack{
+        s_kernelSlack *
+        std::max({m_coordinateMax, std::abs(point.x()), std::abs(point.y())})};
+
+    for (int cBlock{cBegin}; cBlock < cEnd; cBlock += s_kernelWidth) {
+      const int numBlock{std::min(cEnd - cBlock, s_kernelWidth)};
+      const MapKernel xNext{m_points[0].x().data() + cBlock, numBlock};
+      const MapKernel yNext{m_points[0].y().data() + cBlock, numBlock};
+      const MapKernel xPrev{m_points[0].x().data() + cBlock - 1, numBlock};
+      const MapKernel yPrev{m_points[0].y().data() + cBlock - 1, numBlock};
+      const MapKernel xDiff{m_xDiff.data() + cBlock, numBlock};
+      const MapKernel yDiff{m_yDiff.data() + cBlock, numBlock};
+      const MapKernel diffSquare{m_diffSquare.data() + cBlock, numBlock};
+
+      // parameters of shortest distance points clamped to the segments
+      const ArrayKernel segmentPart{
+          (((xNext - point.x()) * xDiff + (yNext - point.y()) * yDiff) /
+           diffSquare)
+              .max(0.0)
+              .min(1.0)};
+      const ArrayKernel distanceSquare{
+          (xPrev * segmentPart + (1 - segmentPart) * xNext - point.x())
+              .square() +
+          (yPrev * segmentPart + (1 - segmentPart) * yNext - point.y())
+              .square()};
+
+      // undefined distances propagate to the sum and require single
+      // projections of the whole block
+      const bool defined{!std::isnan(distanceSquare.sum())};
+      const double distanceSquareMin{defined ? distanceSquare.minCoeff() : 0.0};
+      if (std::sqrt(distanceSquareMin) - slack >
+          std::sqrt(result.distanceSquare))
+        continue;
+
+      const double bound{
+          defined ? std::pow(std::sqrt(distanceSquareMin) + slack, 2)
+                  : std::numeric_limits<double>::infinity()};
+      for (int cLane{}; cLane < numBlock; ++cLane)
+        if (distanceSquare(cLane) <= bound || !defined)
+          project(cBlock + cLane, point, result);
+    }
+  }
+
+  /**
+   * @brief Projects a query point onto a polychain segment.
+   * Updates "result" if the segment is closer than the current result.
+   *
+   * @param cPoints index of the point at the segment end.
+   * @param point query point.
+   * @param result closest point on the polychain found so far.
+   */
+  void project(int cPoints, const Point &point, Nearest &result) const {
+    // point at end of current segment
+    const Point nextPoint{m_points[0](cPoints)};
+    // difference between "nextPoint" and query point
+    const Point diffPoint{nextPoint - point};
+    // parameter determining next point along current linear segment
+    const double segmentPart{
+        (diffPoint.x() * m_xDiff(cPoints) + diffPoint.y() * m_yDiff(cPoints)) /
+        m_diffSquare(cPoints)};
+
+    // squared distance between current segment and query point
+    double distanceSquareCand{};
+    // length along polychain of shortest distance point on segment to query
+    // point
+    double lengthCand{};
+
+    // determine squared distance and length if shortest distance point is
+    // beyond segment end
+    if (segmentPart >= 1.0) {
+      distanceSquareCand = m_points[0](cPoints - 1).distanceSquare(point);
+      lengthCand = m_lengths.data()[cPoints - 1];
+    }
+    // determine squared distance and length if shortest distance point is
+    // beyond segment start
+    else if (segmentPart <= 0.0) {
+      distanceSquareCand = m_points[0](cPoints).distanceSquare(point);
+      lengthCand = m_lengths.data()[cPoints];
+    }
+    // determine squared distance and length if shortest distance point is
+    // on segment
+    else {
+      // point at start of current segment
+      const Point prevPoint{m_points[0](cPoints - 1)};
+      // shortest distance point on current segment
+      const Point pointCand{
+          prevPoint.x() * segmentPart + (1 - segmentPart) * nextPoint.x(),
+          prevPoint.y() * segmentPart + (1 - segmentPart) * nextPoint.y()};
+      distanceSquareCand = point.distanceSquare(pointCand);
+      lengthCand = m_lengths(cPoints - 1) + pointCand.distance(prevPoint);
+    }
+
+    // update length and squared distance if squared distance is smaller
+    // than current minimum
+    if (distanceSquareCand < result.distanceSquare ||
+        (distanceSquareCand == result.distanceSquare &&
+         cPoints < result.segment)) {
+      result = {distanceSquareCand, lengthCand, cPoints};
+    }
+  }
+
   /**
    * @brief Determines 1st order gradient at the given path lengths.
    *
    * @param lengths lengths along the path.
    * @return 1st order gradient at given path lengths.
    */
-  Points<NumQueries> gradient1(const ArrayQueries &lengths) const override {
-    auto indicesGrad{indices(lengths)};
-    for (int &idx : indicesGrad)
-      idx = std::clamp(idx, 1, m_numPoints);
-    return {m_points[1].x()(indicesGrad), m_points[1].y()(indicesGrad)};
+  PointsQueries gradient1(const ArrayQueries &lengths) const final {
+    return gradientsAt(1, lengths);
   }
 
   /**
@@ -212,11 +921,8 @@ private:
    * @param lengths lengths along the path.
    * @return 2nd order gradient at given path lengths.
    */
-  Points<NumQueries> gradient2(const ArrayQueries &lengths) const override {
-    auto indicesGrad{indices(lengths)};
-    for (int &idx : indicesGrad)
-      idx = std::clamp(idx, 2, m_numPoints);
-    return {m_points[2].x()(indicesGrad), m_points[2].y()(indicesGrad)};
+  PointsQueries gradient2(const ArrayQueries &lengths) const final {
+    return gradientsAt(2, lengths);
   }
 
   /**
@@ -225,30 +931,141 @@ private:
    * @param lengths lengths along the path.
    * @return 3rd order gradient at given path lengths.
    */
-  Points<NumQueries> gradient3(const ArrayQueries &lengths) const override {
-    auto indicesGrad{indices(lengths)};
-    for (int &idx : indicesGrad)
-      idx = std::clamp(idx, 3, m_numPoints);
-    return {m_points[3].x()(indicesGrad), m_points[3].y()(indicesGrad)};
+  PointsQueries gradient3(const ArrayQueries &lengths) const final {
+    return gradientsAt(3, lengths);
   }
 
   /**
-   * @brief Determines indices of polychain segment corresponding to the given
-   * path lengths.
+   * @brief Determines the gradients of the given order at the given path
+   * lengths.
    *
+   * @param order order of the gradient.
    * @param lengths lengths along the path.
-   * @return indices corresponding to given path lengths.
+   * @return gradients of the given order at the path lengths.
    */
-  Eigen::Array<int, NumQueries, 1> indices(const ArrayQueries &lengths) const {
-    Eigen::Array<int, NumQueries, 1> result(
-        lengths.rows()); // vector of segment indices
+  PointsQueries gradientsAt(int order, const ArrayQueries &lengths) const {
+    PointsQueries result{};
+    result.resize(lengths.rows());
+    forEachSegment(lengths, [this, order, &result](int row, int index) {
+      const Point grad{gradientAt(order, index)};
+      result.x()(row) = grad.x();
+      result.y()(row) = grad.y();
+    });
+    return result;
+  }
 
-    // get indices of next segments
-    for (int row{}; row < lengths.rows(); ++row)
-      result(row) = FrenetTransform::first(m_lengths - lengths(row));
+  /**
+   * @brief Gets the point along the polychain at the query length within a
+   * known segment.
+   *
+   * @param length query length along the polychain.
+   * @param index index of the polychain segment of the length.
+   * @return Point at the query length.
+   */
+  Point pointAt(double length, int index) const {
+    const int start{index > 0 ? index - 1 : index};
+
+    // relative position along the linear segment
+    const double segmentPart{
+        std::clamp((length - m_lengths(start)) /
+                       (m_lengths(start + 1) - m_lengths(start)),
+                   0.0, 1.0)};
+
+    // absolute position along path
+    return {m_points[0].x(start + 1) * segmentPart +
+                m_points[0].x(start) * (1 - segmentPart),
+            m_points[0].y(start + 1) * segmentPart +
+                m_points[0].y(start) * (1 - segmentPart)};
+  }
+
+  /**
+   * @brief Determines the Frenet frame at the query length within a known
+   * segment. Only evaluates the gradients required by the requested
+   * properties.
+   *
+   * @param length query length along the polychain.
+   * @param index index of the polychain segment of the length.
+   * @param properties mask of FrameProperty values to determine.
+   * @return Frame<Scalar> frame with the requested properties.
+   */
+  Frame<Scalar> frameAt(double length, int index,
+                        unsigned int properties) const {
+    Frame<Scalar> result{};
+    if (properties & FramePoints)
+      result.point = BasicPoint<Scalar>{pointAt(length, index)};
+    if (!(properties & (FrameTangents | FrameCurvatures | FrameCurvatureRates)))
+      return result;
 
+    const Point grad1{gradientAt(1, index)};
+    if (properties & FrameTangents) {
+      result.tangent = BasicPoint<Scalar>{grad1};
+      result.normal = BasicPoint<Scalar>{Point{-grad1.y(), grad1.x()}};
+    }
+    if (!(properties & (FrameCurvatures | FrameCurvatureRates)))
+      return result;
+
+    const Point grad2{gradientAt(2, index)};
+    if (properties & FrameCurvatures)
+      result.curvature = this->curvature(grad1, grad2);
+    if (properties & FrameCurvatureRates)
+      result.curvatureRate =
+          this->curvatureRate(grad1, grad2, gradientAt(3, index));
     return result;
   }
+
+  /**
+   * @brief Determines the gradient of the given order within a known segment.
+   * Gradients of orders without enough points for their differences are zero.
+   *
+   * @param order order of the gradient.
+   * @param index index of the polychain segment.
+   * @return Point gradient of the given order at the segment.
+   */
+  Point gradientAt(int order, int index) const {
+    if (order >= m_numPoints)
+      return {0.0, 0.0};
+    const int indexGrad{std::clamp(index, order, m_numPoints)};
+    return {m_points[order].x(indexGrad), m_points[order].y(indexGrad)};
+  }
+
+  /**
+   * @brief Visits the indices of the polychain segments corresponding to the
+   * given path lengths.
+   * Ascending lengths are resolved in a single walk along the polychain,
+   * others by bisection. Searches start at the bucket of the length if
+   * buckets are available.
+   *
+   * @tparam Visitor callable taking the row of a length and its segment index.
+   * @param lengths lengths along the path.
+   * @param visit evaluates the path properties at a segment.
+   */
+  template <typename Visitor>
+  void forEachSegment(const ArrayQueries &lengths, Visitor &&visit) const {
+    // walk along the polychain for ascending lengths
+    const bool sorted{isAscending(lengths)};
+
+    // get indices of next segments
+    int index{};
+    for (int row{}; row < lengths.rows(); ++row) {
+      const int start{
+          std::max(sorted && row > 0 ? index : 0, lookup(lengths(row)))};
+      index = FrenetTransform::firstSorted(m_lengths, lengths(row), start);
+      visit(row, index);
+    }
+  }
+
+  /**
+   * @brief Whether the lengths are in ascending order.
+   *
+   * @param lengths lengths along the path.
+   * @return true if no length is less than its predecessor or not a number.
+   */
+  static bool isAscending(const ArrayQueries &lengths) {
+    for (int row{1}; row < lengths.rows(); ++row)
+      if (!(lengths(row - 1) <= lengths(row)))
+        return false;
+    return true;
+  }
 };
 }; // namespace FrenetTransform
 
@@ -0,0 +1,108 @@
+#ifndef RESAMPLE_H
+#define RESAMPLE_H
+
+#include <Eigen/Core>
+#include <algorithm>
+#include <cmath>
+
+#include "frenetTransform/frames.h"
+#include "frenetTransform/internal/math.h"
+#include "frenetTransform/path.h"
+
+namespace FrenetTransform {
+/**
+ * @brief Lengths of polychain points along a path which distribute a fixed
+ * number of points according to the local curvature and curvature rate.
+ *
+ * Segments of a polychain deviate from the tangents of the path by about
+ * |curvature| * h / 2 + |curvatureRate| * h^2 / 8 for a segment length h.
+ * The spacing equalizes this heading error, which bounds the errors of
+ * normals and thus of Cartesian positions at lateral offsets. Adjacent
+ * spacings grow by at most "growthMax", since polychain curvatures degrade
+ * with the length ratio of adjacent segments. Constant curvature results in
+ * uniform spacing.
+ *
+ * The path properties are sampled with a spacing of 1/16 of the uniform one,
+ * thus shorter curvature changes are smeared.
+ *
+ * @param path path to sample.
+ * @param lengthBegin length of the first point.
+ * @param lengthEnd length of the last point.
+ * @param numPoints number of points, at least two.
+ * @param growthMax maximum ratio of adjacent spacings, larger than one.
+ * @return Eigen::ArrayXd ascending lengths from "lengthBegin" to "lengthEnd".
+ */
+inline Eigen::ArrayXd resample(const Path<Eigen::Dynamic> &path,
+                               double lengthBegin, double lengthEnd,
+                               int numPoints, double growthMax = 2.0) {
+  eigen_assert(numPoints >= 2);
+  constexpr int samplesPerSpacing{16};
+  const int numSamples{samplesPerSpacing * (numPoints - 1) + 1};
+  const Eigen::ArrayXd samples{
+      Eigen::ArrayXd::LinSpaced(numSamples, lengthBegin, lengthEnd)};
+  const double range{lengthEnd - lengthBegin};
+  const double sampleSpacing{range / (numSamples - 1)};
+  const Frames<Eigen::Dynamic> frames{
+      path.frames(samples, FrameCurvatures | FrameCurvatureRates)};
+  const Eigen::ArrayXd curvatures{frames.curvatures.abs()};
+  const Eigen::ArrayXd curvatureRates{frames.curvatureRates.abs()};
+
+  // point densities with spacings for the heading error "error"
+  const double slope{std::log(growthMax)};
+  Eigen::ArrayXd spacings(numSamples);
+  const auto density{[&](double error) {
+    for (int sample{}; sample < numSamples; ++sample)
+      spacings(sample) =
+          std::min({2 * error / curvatures(sample),
+                    std::sqrt(8 * error / curvatureRates(sample)), range});
+    // limit the growth of spacings in both directions, spacings growing
+    // linearly by "slope" per length grow by exp(slope) per segment
+    for (int sample{1}; sample < numSamples; ++sample)
+      spacings(sample) = std::min(spacings(sample),
+                                  spacings(sample - 1) + slope * sampleSpacing);
+    for (int sample{numSamples - 2}; sample >= 0; --sample)
+      spacings(sample) = std::min(spacings(sample),
+                                  spacings(sample + 1) + slope * sampleSpacing);
+    return spacings.inverse();
+  }};
+
+  // cumulative number of segments by the trapezoidal rule
+  const auto segments{[&](const Eigen::ArrayXd &densities) {
+    Eigen::ArrayXd result(numSamples);
+    result(0) = 0.0;
+    for (int sample{1}; sample < numSamples; ++sample)
+      result(sample) = result(sample - 1) + (densities(sample - 1) +
+                                             densities(sample)) /
+                                                2 * sampleSpacing;
+    return result;
+  }};
+
+  // bisect the heading error for the number of segments in logarithmic scale,
+  // numbers of segments decrease with the error
+  double errorLower{std::log(1e-12)};
+  double errorUpper{std::log(M_PI)};
+  for (int iteration{}; iteration < 64; ++iteration) {
+    const double error{(errorLower + errorUpper) / 2};
+    if (segments(density(std::exp(error)))(numSamples - 1) > numPoints - 1)
+      errorLower = error;
+    else
+      errorUpper = error;
+  }
+  Eigen::ArrayXd cumulative{segments(density(std::exp(errorUpper)))};
+  cumulative *= (numPoints - 1) / cumulative(numSamples - 1);
+
+  // invert the cumulative number of segments at integral numbers
+  Eigen::ArrayXd result(numPoints);
+  result(0) = lengthBegin;
+  for (int point{1}, sample{1}; point < numPoints - 1; ++point) {
+    sample = firstSorted(cumulative, point, sample);
+    const double part{(point - cumulative(sample - 1)) /
+                      (cumulative(sample) - cumulative(sample - 1))};
+    result(point) = samples(sample - 1) + part * sampleSpacing;
+  }
+  result(numPoints - 1) = lengthEnd;
+  return result;
+}
+}; // namespace FrenetTransform
+
+#endif
@@ -0,0 +1,220 @@
+#ifndef SIMPLIFY_H
+#define SIMPLIFY_H
+
+#include <Eigen/Core>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "frenetTransform/frames.h"
+#include "frenetTransform/internal/math.h"
+#include "frenetTransform/point.h"
+#include "frenetTransform/points.h"
+#include "frenetTransform/polychain.h"
+
+namespace FrenetTransform {
+/**
+ * @brief Points of a simplified polychain and the errors introduced by the
+ * simplification.
+ *
+ */
+struct Simplified {
+  Points<Eigen::Dynamic> points{}; /**<< kept points in original order */
+  Eigen::ArrayXi indices{};        /**<< indices of kept original points */
+  double deviation{}; /**<< maximum distance of original points to chain */
+  double curvatureError{}; /**<< maximum difference of curvatures */
+};
+
+/**
+ * @brief Removes points of a polychain within a lateral deviation and a
+ * curvature error. Keeps the first and last point.
+ *
+ * Douglas-Peucker simplification keeps the point farthest from the segment
+ * between two kept points until all removed points are within "deviationMax"
+ * of their segment. Afterwards, the curvatures of the simplified polychain
+ * are compared with the original ones at the projections of the original
+ * segment centers. Segments exceeding "curvatureErrorMax" are split such that
+ * the lengths of adjacent segments grade within the ratio the bound allows,
+ * until no error exceeds the bound or only original segments remain.
+ *
+ * Lengths along the simplified polychain are shorter than along the original
+ * one by the chords of the removed points.
+ *
+ * @param x coordinates in x-direction along the path.
+ * @param y coordinates in y-direction along the path.
+ * @param deviationMax maximum distance of removed points to the simplified
+ * polychain.
+ * @param curvatureErrorMax maximum absolute difference of curvatures.
+ * @return Simplified kept points and the achieved errors.
+ */
+inline Simplified
+simplify(const Eigen::ArrayXd &x, const Eigen::ArrayXd &y,
+         double deviationMax,
+         double curvatureErrorMax = std::numeric_limits<double>::infinity()) {
+  const int numPoints{static_cast<int>(x.rows())};
+  std::vector<bool> keep(numPoints, true);
+  if (numPoints < 3)
+    return {Points<Eigen::Dynamic>{x, y},
+            Eigen::ArrayXi::LinSpaced(numPoints, 0, numPoints - 1)};
+
+  // interior point farthest from the segment between "begin" and "end"
+  const auto farthest{[&x, &y](int begin, int end) {
+    const Point start{x(begin), y(begin)};
+    const Point diff{Point{x(end), y(end)} - start};
+    const double diffSquare{diff.x() * diff.x() + diff.y() * diff.y()};
+    std::pair<int, double> result{begin, 0.0};
+    for (int index{begin + 1}; index < end; ++index) {
+      const Point point{x(index), y(index)};
+      const double part{
+          diffSquare > 0.0
+              ? std::clamp(((point.x() - start.x()) * diff.x() +
+                            (point.y() - start.y()) * diff.y()) /
+                               diffSquare,
+                           0.0, 1.0)
+              : 0.0};
+      const double distanceSquare{point.distanceSquare(
+          Point{start.x() + part * diff.x(), start.y() + part * diff.y()})};
+      if (distanceSquare > result.second)
+        result = {index, distanceSquare};
+    }
+    return result;
+  }};
+
+  // splits spans until all removed points are within the deviation
+  const double deviationSquare{deviationMax * deviationMax};
+  std::vector<std::pair<int, int>> spans{};
+  const auto refine{[&keep, &spans, &farthest, deviationSquare](int begin,
+                                                                int end) {
+    spans.push_back({begin, end});
+    while (!spans.empty()) {
+      const auto [spanBegin, spanEnd]{spans.back()};
+      spans.pop_back();
+      const auto [index, distanceSquare]{farthest(spanBegin, spanEnd)};
+      if (!(distanceSquare > deviationSquare))
+        continue;
+      keep[index] = true;
+      spans.push_back({spanBegin, index});
+      spans.push_back({index, spanEnd});
+    }
+  }};
+  std::fill(keep.begin() + 1, keep.end() - 1, false);
+  refine(0, numPoints - 1);
+
+  // original curvatures at the segment centers
+  const Polychain<Eigen::Dynamic> original{x, y};
+  const Eigen::ArrayXd lengths{partialLength<Eigen::Dynamic>(x, y)};
+  const Eigen::ArrayXd centers{
+      (lengths.head(numPoints - 1) + lengths.tail(numPoints - 1)) / 2};
+  const Points<Eigen::Dynamic> centerPoints{original(centers)};
+  const Eigen::ArrayXd curvatures{
+      original.frames(centers, FrameCurvatures).curvatures};
+
+  Simplified result{};
+  while (true) {
+    std::vector<int> indices{};
+    for (int index{}; index < numPoints; ++index)
+      if (keep[index])
+        indices.push_back(index);
+    result.indices = Eigen::Map<const Eigen::ArrayXi>(
+        indices.data(), static_cast<int>(indices.size()));
+    result.points = {x(result.indices), y(result.indices)};
+
+    const Polychain<Eigen::Dynamic> simplified{result.points};
+    const Eigen::ArrayXd lengthsSimplified{simplified.lengths(centerPoints)};
+    const Eigen::ArrayXd curvatureErrors{
+        (simplified.frames(lengthsSimplified, FrameCurvatures).curvatures -
+         curvatures)
+            .abs()};
+    result.curvatureError = curvatureErrors.maxCoeff();
+    if (!(result.curvatureError > curvatureErrorMax))
+      break;
+
+    // curvatures of polychain segments are the turning angles at their start
+    // divided by their lengths, thus errors grow with the length ratio of
+    // adjacent segments and with curvature changes within segments
+    const Eigen::ArrayXd kept{lengths(result.indices)};
+    const int numSpans{static_cast<int>(indices.size()) - 1};
+    std::vector<double> splits(numSpans, -1.0);
+    bool splitFirst{false};
+    for (int span{}, segment{}; span < numSpans; ++span) {
+      double curvature{};
+      int first{-1};
+      for (; segment < indices[span + 1]; ++segment)
+        if (curvatureErrors(segment) > curvatureErrorMax) {
+          first = first < 0 ? segment : first;
+          curvature = std::max(curvature, std::abs(curvatures(segment)));
+        }
+      if (first < 0)
+        continue;
+      // first segment shares the curvature of the second one
+      if (span == 0) {
+        splitFirst = true;
+        continue;
+      }
+      // curvature changes within the segment split at the first error
+      if (first > indices[span]) {
+        splits[span] = lengths(first);
+        continue;
+      }
+
+      // length ratio of adjacent segments with half the error bound, which
+      // leaves the other half for rounding to original points
+      const double growth{
+          curvatureErrorMax < curvature
+              ? std::min(1 / (1 - curvatureErrorMax / curvature), 2.0)
+              : 2.0};
+      // grade the longer segment without a shorter remainder
+      const double spanLength{kept(span + 1) - kept(span)};
+      const double previousLength{kept(span) - kept(span - 1)};
+      if (indices[span + 1] - indices[span] < 2 ||
+          previousLength > growth * spanLength)
+        splits[span - 1] =
+            kept(span) - std::min(growth * spanLength,
+                                  previousLength / (1 + growth));
+      else if (spanLength > growth * previousLength)
+        splits[span] =
+            kept(span) + std::min(growth * previousLength,
+                                  spanLength / (1 + growth));
+      else
+        splits[span] = kept(span) + spanLength / 2;
+    }
+
+    // keeping the second original point restores the first curvature
+    bool changed{false};
+    if (splitFirst && indices[1] > 1) {
+      keep[1] = true;
+      refine(1, indices[1]);
+      changed = true;
+    }
+    for (int span{}; span < numSpans; ++span) {
+      const int begin{indices[span]};
+      const int end{indices[span + 1]};
+      if (splits[span] < 0.0 || end - begin < 2 || (span == 0 && splitFirst))
+        continue;
+      // original point closest to the split length
+      int index{firstSorted(lengths, splits[span], begin)};
+      if (lengths(index) - splits[span] > splits[span] - lengths(index - 1))
+        --index;
+      index = std::clamp(index, begin + 1, end - 1);
+      keep[index] = true;
+      refine(begin, index);
+      refine(index, end);
+      changed = true;
+    }
+    if (!changed)
+      break;
+  }
+
+  // distances of the original points to their simplified segments
+  for (int span{}; span < result.indices.rows() - 1; ++span)
+    result.deviation = std::max(
+        result.deviation,
+        farthest(result.indices(span), result.indices(span + 1)).second);
+  result.deviation = std::sqrt(result.deviation);
+  return result;
+}
+}; // namespace FrenetTransform
+
+#endif
@@ -0,0 +1,642 @@
+#ifndef SPLINE_H
+#define SPLINE_H
+
+#include <Eigen/Core>
+#include <Eigen/SparseCore>
+#include <Eigen/SparseLU>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "frenetTransform/frames.h"
+#include "frenetTransform/internal/math.h"
+#include "frenetTransform/internal/pointwisePath.h"
+#include "frenetTransform/internal/segmentTree.h"
+#include "frenetTransform/point.h"
+#include "frenetTransform/points.h"
+
+namespace FrenetTransform {
+/**
+ * @brief Path representation as spline parametrized by arc length.
+ * Interpolates the given points with quintic polynomials in x- and
+ * y-direction with continuous derivatives up to 4th order. Fewer than six
+ * points result in a not-a-knot cubic spline instead. The knot parameters are
+ * refitted to the arc lengths of the spans several times, such that the
+ * spline parameter approximates the arc length along the path.
+ *
+ * Path properties are analytic derivatives of the spans instead of finite
+ * differences. Tangents, curvatures and curvature derivatives are those of
+ * the spline curve, independent of the deviation between parameter and arc
+ * length, and continuous along the path. Thus, far fewer points than for a
+ * Polychain represent smooth paths at the same accuracy.
+ *
+ * Query points are projected onto the spans with Newton's method, starting
+ * from the projection onto the chord of the span. Spans are only projected
+ * onto if their bounding box is closer than the closest point found so far.
+ *
+ * @tparam NumQueries number of query points with -1 for dynamic point number.
+ * @tparam Scalar floating point type of the query points and properties.
+ */
+template <int NumQueries = Eigen::Dynamic, typename Scalar = double>
+class Spline : public Internal::PointwisePath<NumQueries, Scalar> {
+public:
+  Spline() = default;
+
+  /**
+   * @brief Construct a new Spline object through Cartesian x- and
+   * y-positions.
+   *
+   * @param x coordinates in x-direction along the path.
+   * @param y coordinates in y-direction along the path.
+   */
+  Spline(const Eigen::ArrayXd &x, const Eigen::ArrayXd &y) { setPoints(x, y); }
+
+  /**
+   * @brief Construct a new Spline object through points in Cartesian
+   * coordinates.
+   *
+   * @param points points along the path.
+   */
+  Spline(const Points<Eigen::Dynamic> &points) {
+    setPoints(points.x(), points.y());
+  }
+
+  /**
+   * @brief Determines the Frenet frame at a single path length without
+   * arrays or allocation. Lengths exceeding the domain resolve to the first
+   * or last point.
+   *
+   * @param length length along the path.
+   * @param properties mask of FrameProperty values to determine.
+   * @return Frame<Scalar> frame with the requested properties.
+   */
+  Frame<Scalar> frame(Scalar length,
+                      unsigned int properties = FrameAll) const final {
+    const int span{spanAt(length)};
+    const double part{partAt(length, span)};
+
+    Frame<Scalar> result{};
+    if (properties & FramePoints)
+      result.point = BasicPoint<Scalar>{evaluate(span, part, 0)};
+    if (!(properties & (FrameTangents | FrameCurvatures | FrameCurvatureRates)))
+      return result;
+
+    const Geometry geometry{geometryAt(span, part)};
+    if (properties & FrameTangents) {
+      result.tangent = BasicPoint<Scalar>{geometry.tangent};
+      result.normal = BasicPoint<Scalar>{
+          Point{-geometry.tangent.y(), geometry.tangent.x()}};
+    }
+    if (properties & FrameCurvatures)
+      result.curvature = geometry.curvature;
+    if (properties & FrameCurvatureRates)
+      result.curvatureRate = geometry.curvatureRate;
+    return result;
+  }
+
+  /**
+   * @brief Determines the next point to a single query point without arrays
+   * or allocation.
+   *
+   * @param point query point.
+   * @return Scalar length next to the query point.
+   */
+  Scalar length(const BasicPoint<Scalar> &point) const final {
+    return nearest(Point{point}).length;
+  }
+
+  /**
+   * @brief Determines the next point to a single query point close to a
+   * previous length without arrays or allocation. Only projects onto the spline
+   * within "window" around the hint. Falls back to the search over all spans if
+   * the closest point is at the window edge or the hint is not finite.
+   *
+   * @param point query point.
+   * @param hint previous length along the spline.
+   * @param window maximum length difference to the hint searched locally.
+   * @return Scalar length next to the query point.
+   */
+  Scalar length(const BasicPoint<Scalar> &point, Scalar hint,
+                Scalar window) const final {
+    return nearest(Point{point}, hint, window).length;
+  }
+
+  /**
+   * @brief Provide new points for the spline.
+   * Fits the spans and their arc lengths and rebuilds the tree over their
+   * bounding boxes.
+   *
+   * @param x coordinates in x-direction of new points.
+   * @param y coordinates in y-direction of new points.
+   */
+  void setPoints(const Eigen::ArrayXd &x, const Eigen::ArrayXd &y) {
+    m_numPoints = static_cast<int>(x.rows());
+    m_lengths = FrenetTransform::partialLength(x, y);
+    if (m_numPoints < 2) {
+      m_coeffsX = Coeffs::Zero(0, s_numCoeffs);
+      m_coeffsY = Coeffs::Zero(0, s_numCoeffs);
+      m_tree = Internal::SegmentTree{};
+      return;
+    }
+
+    // refit the knot parameters to the arc lengths of the spans
+    for (int cFit{}; cFit < s_numFits; ++cFit) {
+      m_coeffsX = fit(m_lengths, x);
+      m_coeffsY = fit(m_lengths, y);
+      Eigen::ArrayXd arcLengths(m_numPoints);
+      arcLengths(0) = 0.0;
+      for (int span{}; span < m_numPoints - 1; ++span)
+        arcLengths(span + 1) = arcLengths(span) + spanArcLength(span);
+      m_lengths = arcLengths;
+    }
+    m_coeffsX = fit(m_lengths, x);
+    m_coeffsY = fit(m_lengths, y);
+
+    std::vector<Internal::Box> boxes(m_numPoints - 1);
+    for (int span{}; span < m_numPoints - 1; ++span)
+      boxes[span] = box(span);
+    m_tree = Internal::SegmentTree{std::move(boxes)};
+  }
+
+  /**
+   * @brief Provides the lengths along the spline at the given points.
+   *
+   * @return const Eigen::ArrayXd& lengths at the points.
+   */
+  const Eigen::ArrayXd &knotLengths() const { return m_lengths; }
+
+private:
+  static constexpr int s_numCoeffs{6}; /**<< coefficients per polynomial */
+  using Coeffs = Eigen::Array<double, Eigen::Dynamic, s_numCoeffs>;
+
+  /**
+   * @brief Closest point on the spline to a query point.
+   *
+   */
+  struct Nearest {
+    // squared distance between query point and spline
+    double distanceSquare{std::numeric_limits<double>::infinity()};
+    double length{}; /**<< length along the spline */
+    int span{};      /**<< index of the span */
+  };
+
+  /**
+   * @brief Tangent, curvature and curvature derivative of the spline curve.
+   *
+   */
+  struct Geometry {
+    Point tangent{};        /**<< unit tangent vector */
+    double curvature{};     /**<< curvature */
+    double curvatureRate{}; /**<< curvature derivative by arc length */
+  };
+
+  int m_numPoints{};          /**<< number of points along the spline */
+  Eigen::ArrayXd m_lengths{}; /**<< lengths at the points */
+  Coeffs m_coeffsX{};         /**<< polynomial coefficients in x per span */
+  Coeffs m_coeffsY{};         /**<< polynomial coefficients in y per span */
+  Internal::SegmentTree m_tree{}; /**<< tree over the span boxes */
+
+  static constexpr int s_numFits{4};   /**<< refits of the knot parameters */
+  static constexpr int s_numNewton{8}; /**<< maximum Newton steps per span */
+  // minimum number of points for quintic instead of cubic spans
+  static constexpr int s_numPointsQuintic{6};
+
+  /**
+   * @brief Fits a spline through "values" at "params".
+   * Fits a quintic spline if there are enough knots for its end conditions
+   * and a cubic spline otherwise.
+   *
+   * @param params increasing knot parameters.
+   * @param values values at the knots.
+   * @return Coeffs coefficients of the polynomials in the span parameter,
+   * one row per span in ascending order of powers.
+   */
+  static Coeffs fit(const Eigen::ArrayXd &params,
+                    const Eigen::ArrayXd &values) {
+    return params.rows() < s_numPointsQuintic ? fitCubic(params, values)
+                                              : fitQuintic(params, values);
+  }
+
+  /**
+   * @brief Fits a quintic spline with continuous derivatives up to 4th order
+   * through "values" at "params".
+   * The second derivative is a cubic spline through the second derivatives
+   * at the knots, whose own second derivatives are the fourth derivatives at
+   * the knots. Continuous first and third derivatives at the interior knots
+   * determine both. The first three and the last three spans are single
+   * polynomials each, thus the fifth derivative is continuous at the second
+   * and third knot from either end.
+   *
+   * @param params increasing knot parameters.
+   * @param values values at the knots.
+   * @return Coeffs coefficients of the polynomials in the span parameter,
+   * one row per span in ascending order of powers.
+   */
+  static Coeffs fitQuintic(const Eigen::ArrayXd &params,
+                           const Eigen::ArrayXd &values) {
+    const int numPoints{static_cast<int>(params.rows())};
+    const int numSpans{numPoints - 1};
+    const Eigen::ArrayXd steps{params.tail(numSpans) - params.head(numSpans)};
+    const Eigen::ArrayXd slopes{
+        (values.tail(numSpans) - values.head(numSpans)) / steps};
+
+    // unknowns alternate between second and fourth derivatives at the knots
+    const auto second{[](int knot) { return 2 * knot; }};
+    const auto fourth{[](int knot) { return 2 * knot + 1; }};
+    std::vector<Eigen::Triplet<double>> entries{};
+    entries.reserve(12 * numPoints);
+    Eigen::VectorXd rhs{Eigen::VectorXd::Zero(2 * numPoints)};
+
+    int row{};
+    for (int knot{1}; knot < numSpans; ++knot) {
+      const double stepPrev{steps(knot - 1)};
+      const double step{steps(knot)};
+      const double stepPrevCube{std::pow(stepPrev, 3)};
+      const double stepCube{std::pow(step, 3)};
+
+      // continuous first derivative
+      entries.insert(
+          entries.end(),
+          {{row, second(knot - 1), stepPrev / 6},
+           {row, second(knot), (stepPrev + step) / 3},
+           {row, second(knot + 1), step / 6},
+           {row, fourth(knot - 1), -7 * stepPrevCube / 360},
+           {row, fourth(knot), -(stepPrevCube + stepCube) / 45},
+           {row, fourth(knot + 1), -7 * stepCube / 360}});
+      rhs(row++) = slopes(knot) - slopes(knot - 1);
+
+      // continuous third derivative
+      entries.insert(entries.end(),
+                     {{row, second(knot - 1), -6 / stepPrev},
+                      {row, second(knot), 6 / stepPrev + 6 / step},
+                      {row, second(knot + 1), -6 / step},
+                      {row, fourth(knot - 1), stepPrev},
+                      {row, fourth(knot), 2 * (stepPrev + step)},
+                      {row, fourth(knot + 1), step}});
+      ++row;
+    }
+
+    // continuous fifth derivative
+    for (const int knot : {1, 2, numSpans - 2, numSpans - 1}) {
+      entries.insert(
+          entries.end(),
+          {{row, fourth(knot - 1), 1 / steps(knot - 1)},
+           {row, fourth(knot), -1 / steps(knot - 1) - 1 / steps(knot)},
+           {row, fourth(knot + 1), 1 / steps(knot)}});
+      ++row;
+    }
+
+    Eigen::SparseMatrix<double> system(2 * numPoints, 2 * numPoints);
+    system.setFromTriplets(entries.begin(), entries.end());
+    Eigen::SparseLU<Eigen::SparseMatrix<double>> solver{system};
+    const Eigen::VectorXd ders{solver.solve(rhs)};
+    const Eigen::ArrayXd secondDers{
+        Eigen::Map<const Eigen::ArrayXd, 0, Eigen::InnerStride<2>>(
+            ders.data(), numPoints)};
+    const Eigen::ArrayXd fourthDers{
+        Eigen::Map<const Eigen::ArrayXd, 0, Eigen::InnerStride<2>>(
+            ders.data() + 1, numPoints)};
+
+    const auto head{[numSpans](const Eigen::ArrayXd &knots) {
+      return knots.head(numSpans);
+    }};
+    const auto tail{[numSpans](const Eigen::ArrayXd &knots) {
+      return knots.tail(numSpans);
+    }};
+    Coeffs result(numSpans, s_numCoeffs);
+    result.col(0) = head(values);
+    result.col(1) = slopes -
+                    steps * (2 * head(secondDers) + tail(secondDers)) / 6 +
+                    steps.cube() *
+                        (8 * head(fourthDers) + 7 * tail(fourthDers)) / 360;
+    result.col(2) = head(secondDers) / 2;
+    result.col(3) = ((tail(secondDers) - head(secondDers)) / steps -
+                     steps * (2 * head(fourthDers) + tail(fourthDers)) / 6) /
+                    6;
+    result.col(4) = head(fourthDers) / 24;
+    result.col(5) = (tail(fourthDers) - head(fourthDers)) / (120 * steps);
+    return result;
+  }
+
+  /**
+   * @brief Fits a not-a-knot cubic spline through "values" at "params".
+   * Solves the tridiagonal system of the second derivatives at the knots
+   * after eliminating the not-a-knot conditions. Two knots result in a line
+   * and three knots in a parabola.
+   *
+   * @param params increasing knot parameters.
+   * @param values values at the knots.
+   * @return Coeffs coefficients of the polynomials in the span parameter,
+   * one row per span in ascending order of powers.
+   */
+  static Coeffs fitCubic(const Eigen::ArrayXd &params,
+                         const Eigen::ArrayXd &values) {
+    const int numPoints{static_cast<int>(params.rows())};
+    const int numSpans{numPoints - 1};
+    const Eigen::ArrayXd steps{params.tail(numSpans) - params.head(numSpans)};
+    const Eigen::ArrayXd slopes{
+        (values.tail(numSpans) - values.head(numSpans)) / steps};
+
+    // second derivatives at the knots
+    Eigen::ArrayXd secondDers{Eigen::ArrayXd::Zero(numPoints)};
+    if (numSpans == 2) {
+      secondDers.setConstant(2 * (slopes(1) - slopes(0)) /
+                             (steps(0) + steps(1)));
+    } else if (numSpans > 2) {
+      // tridiagonal system of the interior knots
+      const int numRows{numPoints - 2};
+      Eigen::ArrayXd lower(numRows);
+      Eigen::ArrayXd diag(numRows);
+      Eigen::ArrayXd upper(numRows);
+      Eigen::ArrayXd rhs(numRows);
+      for (int row{}; row < numRows; ++row) {
+        lower(row) = steps(row);
+        diag(row) = 2 * (steps(row) + steps(row + 1));
+        upper(row) = steps(row + 1);
+        rhs(row) = 6 * (slopes(row + 1) - slopes(row));
+      }
+      // eliminate the first and last second derivatives by continuous third
+      // derivatives at the second and second to last knot
+      diag(0) += steps(0) * (steps(0) + steps(1)) / steps(1);
+      upper(0) -= steps(0) * steps(0) / steps(1);
+      const int last{numSpans - 1};
+      diag(numRows - 1) +=
+          steps(last) * (steps(last) + steps(last - 1)) / steps(last - 1);
+      lower(numRows - 1) -= steps(last) * steps(last) / steps(last - 1);
+
+      // forward elimination and back substitution
+      for (int row{1}; row < numRows; ++row) {
+        const double factor{lower(row) / diag(row - 1)};
+        diag(row) -= factor * upper(row - 1);
+        rhs(row) -= factor * rhs(row - 1);
+      }
+      secondDers(numRows) = rhs(numRows - 1) / diag(numRows - 1);
+      for (int row{numRows - 2}; row >= 0; --row)
+        secondDers(row + 1) =
+            (rhs(row) - upper(row) * secondDers(row + 2)) / diag(row);
+
+      secondDers(0) = ((steps(0) + steps(1)) * secondDers(1) -
+                       steps(0) * secondDers(2)) /
+                      steps(1);
+      secondDers(numSpans) =
+          ((steps(last) + steps(last - 1)) * secondDers(numSpans - 1) -
+           steps(last) * secondDers(numSpans - 2)) /
+          steps(last - 1);
+    }
+
+    Coeffs result{Coeffs::Zero(numSpans, s_numCoeffs)};
+    result.col(0) = values.head(numSpans);
+    result.col(1) =
+        slopes - steps * (2 * secondDers.head(numSpans) +
+                          secondDers.tail(numSpans)) /
+                     6;
+    result.col(2) = secondDers.head(numSpans) / 2;
+    result.col(3) =
+        (secondDers.tail(numSpans) - secondDers.head(numSpans)) / (6 * steps);
+    return result;
+  }
+
+  /**
+   * @brief Determines the arc length of a span by Gauss-Legendre quadrature.
+   *
+   * @param span index of the span.
+   * @return double arc length of the span.
+   */
+  double spanArcLength(int span) const {
+    const double step{spanLength(span)};
+    double result{};
+    for (std::size_t node{}; node < gaussNodes.size(); ++node) {
+      const Point der{evaluate(span, step * (1 + gaussNodes[node]) / 2, 1)};
+      result += gaussWeights[node] * std::hypot(der.x(), der.y());
+    }
+    return result * step / 2;
+  }
+
+  /**
+   * @brief Determines a bounding box of a span from the Bezier control points
+   * of its polynomials, which enclose the span.
+   *
+   * @param span index of the span.
+   * @return Internal::Box bounding box of the span.
+   */
+  Internal::Box box(int span) const {
+    static constexpr int s_degree{s_numCoeffs - 1};
+    static constexpr std::array<double, s_numCoeffs> s_binomials{1.0, 5.0,
+                                                                10.0, 10.0,
+                                                                5.0, 1.0};
+
+    // coefficients of the polynomials over the unit interval
+    std::array<Point, s_numCoeffs> coeffs{};
+    double scale{1.0};
+    for (int power{}; power <= s_degree; ++power) {
+      coeffs[power] = {m_coeffsX(span, power) * scale,
+                       m_coeffsY(span, power) * scale};
+      scale *= spanLength(span);
+    }
+
+    Internal::Box result{};
+    for (int index{}; index <= s_degree; ++index) {
+      // binomial coefficients of "index" choose "power"
+      double binomial{1.0};
+      Point control{};
+      for (int power{}; power <= index; ++power) {
+        const double weight{binomial / s_binomials[power]};
+        control = control + Point{coeffs[power].x() * weight,
+                                  coeffs[power].y() * weight};
+        binomial = binomial * (index - power) / (power + 1);
+      }
+      result.extend(control);
+    }
+    return result;
+  }
+
+  /**
+   * @brief Provides the parameter range of a span.
+   *
+   * @param span index of the span.
+   * @return double difference between the lengths at the span ends.
+   */
+  double spanLength(int span) const {
+    return m_lengths(span + 1) - m_lengths(span);
+  }
+
+  /**
+   * @brief Determines the span containing the given length.
+   * Lengths exceeding the spline's domain resolve to the first or last span.
+   *
+   * @param length length along the spline.
+   * @return int index of the span.
+   */
+  int spanAt(double length) const {
+    return std::clamp(FrenetTransform::firstSorted(m_lengths, length) - 1, 0,
+                      m_numPoints - 2);
+  }
+
+  /**
+   * @brief Determines the parameter within a span at the given length,
+   * clamped to the span.
+   *
+   * @param length length along the spline.
+   * @param span index of the span.
+   * @return double parameter relative to the span start.
+   */
+  double partAt(double length, int span) const {
+    return std::clamp(length - m_lengths(span), 0.0, spanLength(span));
+  }
+
+  /**
+   * @brief Evaluates a derivative of a span's polynomials.
+   *
+   * @param span index of the span.
+   * @param part parameter relative to the span start.
+   * @param order order of the derivative from zero to three.
+   * @return Point derivative of the given order.
+   */
+  Point evaluate(int span, double part, int order) const {
+    Point result{};
+    for (int power{s_numCoeffs - 1}; power >= order; --power) {
+      // derivative factor of the power
+      double factor{1.0};
+      for (int cOrder{}; cOrder < order; ++cOrder)
+        factor *= power - cOrder;
+      result = {result.x() * part + m_coeffsX(span, power) * factor,
+                result.y() * part + m_coeffsY(span, power) * factor};
+    }
+    return result;
+  }
+
+  /**
+   * @brief Determines tangent, curvature and curvature derivative of the
+   * spline curve within a span. The curvature derivative is taken by arc
+   * length instead of the spline parameter.
+   *
+   * @param span index of the span.
+   * @param part parameter relative to the span start.
+   * @return Geometry of the spline curve.
+   */
+  Geometry geometryAt(int span, double part) const {
+    const Point der1{evaluate(span, part, 1)};
+    const Point der2{evaluate(span, part, 2)};
+    const Point der3{evaluate(span, part, 3)};
+    const double speedSquare{der1.x() * der1.x() + der1.y() * der1.y()};
+    const double speed{std::sqrt(speedSquare)};
+    const double cross12{der1.x() * der2.y() - der1.y() * der2.x()};
+    const double cross13{der1.x() * der3.y() - der1.y() * der3.x()};
+    const double dot12{der1.x() * der2.x() + der1.y() * der2.y()};
+    const double speedCube{speedSquare * speed};
+
+    return {{der1.x() / speed, der1.y() / speed},
+            cross12 / speedCube,
+            (cross13 / speedCube -
+             3 * cross12 * dot12 / (speedCube * speedSquare)) /
+                speed};
+  }
+
+  /**
+   * @brief Determines the closest point on the spline to a query point.
+   * Visits the spans in the segment tree nearest first. Equally distant
+   * spans resolve to the one with the smallest index.
+   *
+   * @param point query point.
+   * @return Nearest closest point on the spline.
+   */
+  Nearest nearest(const Point &point) const {
+    Nearest result{};
+    m_tree.nearest(point, [this, &point, &result](int segment) {
+      project(segment - 1, 0.0, spanLength(segment - 1), point, result);
+      return result.distanceSquare;
+    });
+    return result;
+  }
+
+  /**
+   * @brief Determines the closest point on the spline to a query point
+   * within "window" around the length "hint".
+   *
+   * @param point query point.
+   * @param hint previous length along the spline.
+   * @param window maximum length difference to "hint" searched locally.
+   * @return Nearest closest point on the spline.
+   */
+  Nearest nearest(const Point &point, double hint, double window) const {
+    if (m_numPoints < 2 || !std::isfinite(hint))
+      return nearest(point);
+
+    const double lengthMax{m_lengths(m_numPoints - 1)};
+    const double lower{std::clamp(hint - std::abs(window), 0.0, lengthMax)};
+    const double upper{std::clamp(hint + std::abs(window), 0.0, lengthMax)};
+
+    Nearest result{};
+    for (int span{spanAt(lower)}; span <= spanAt(upper); ++span)
+      project(span, partAt(lower, span), partAt(upper, span), point, result);
+
+    if ((result.length <= lower && lower > 0.0) ||
+        (result.length >= upper && upper < lengthMax))
+      return nearest(point);
+
+    return result;
+  }
+
+  /**
+   * @brief Projects a query point onto a span between the parameters
+   * "partMin" and "partMax" and updates the closest point.
+   * Refines the projection onto the chord with Newton's method on the
+   * distance derivative and compares it with the parameter limits.
+   *
+   * @param span index of the span.
+   * @param partMin lower parameter limit relative to the span start.
+   * @param partMax upper parameter limit relative to the span start.
+   * @param point query point.
+   * @param result closest point found so far, updated in place.
+   */
+  void project(int span, double partMin, double partMax, const Point &point,
+               Nearest &result) const {
+    // projection onto the chord between the parameter limits
+    const Point start{evaluate(span, partMin, 0)};
+    const Point chord{evaluate(span, partMax, 0) - start};
+    const double chordSquare{chord.x() * chord.x() + chord.y() * chord.y()};
+    const double chordPart{
+        chordSquare > 0.0
+            ? std::clamp(((point.x() - start.x()) * chord.x() +
+                          (point.y() - start.y()) * chord.y()) /
+                             chordSquare,
+                         0.0, 1.0)
+            : 0.0};
+    double part{partMin + chordPart * (partMax - partMin)};
+
+    // roots of the distance derivative
+    for (int cNewton{}; cNewton < s_numNewton; ++cNewton) {
+      const Point diff{evaluate(span, part, 0) - point};
+      const Point der1{evaluate(span, part, 1)};
+      const Point der2{evaluate(span, part, 2)};
+      const double slope{diff.x() * der1.x() + diff.y() * der1.y()};
+      const double curvature{der1.x() * der1.x() + der1.y() * der1.y() +
+                             diff.x() * der2.x() + diff.y() * der2.y()};
+      if (!(curvature > 0.0))
+        break;
+
+      const double partNext{
+          std::clamp(part - slope / curvature, partMin, partMax)};
+      const bool converged{std::abs(partNext - part) <=
+                           std::numeric_limits<double>::epsilon() *
+                               (m_lengths(span) + partMax)};
+      part = partNext;
+      if (converged)
+        break;
+    }
+
+    for (const double candidate : {part, partMin, partMax}) {
+      const double distanceSquare{
+          evaluate(span, candidate, 0).distanceSquare(point)};
+      if (distanceSquare < result.distanceSquare ||
+          (distanceSquare == result.distanceSquare && span < result.span))
+        result = {distanceSquare, m_lengths(span) + candidate, span};
+    }
+  }
+};
+}; // namespace FrenetTransform
+
+#endif
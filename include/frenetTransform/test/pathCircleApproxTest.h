@@ -0,0 +1,177 @@
+#ifndef PATH_CIRCLE_APPROX_TEST_H
+#define PATH_CIRCLE_APPROX_TEST_H
+
+#include "frenetTransform/frames.h"
+#include "frenetTransform/points.h"
+#include "frenetTransform/test/pathCircleTest.h"
+#include "frenetTransform/transform.h"
+
+#include <Eigen/Core>
+#include <gtest/gtest.h>
+#include <memory>
+
+namespace FrenetTransform {
+namespace Internal {
+/**
+ * @brief Absolute errors allowed for a path approximating the circle.
+ *
+ */
+struct CircleTolerances {
+  double points{};         /**<< points at the lengths */
+  double tangents{};       /**<< unit tangents at the lengths */
+  double angles1{};        /**<< 1st order angle derivatives */
+  double angles2{};        /**<< 2nd order angle derivatives */
+  double curvatureRates{}; /**<< curvature rates of frames and angle2 */
+  double lengths{};        /**<< lengths of projected points */
+  double posFrenet{};      /**<< positions in the frenet frame */
+  double velFrenet{};      /**<< velocities in the frenet frame */
+  double accFrenet{};      /**<< accelerations in the frenet frame */
+  double accCartes{};      /**<< accelerations in cartesian coordinates */
+};
+
+/**
+ * @brief Path approximating the circle of PathCircleTest.
+ * The type parameter "Approx" provides the number of queries as "Queries",
+ * the path type as "PathType", its construction from the circle radius as
+ * "approximate" and the allowed errors as "s_tolerances".
+ *
+ * @tparam Approx traits of the approximating path.
+ */
+template <typename Approx>
+class PathCircleApproxTest
+    : public PathCircleStateTest<typename Approx::Queries> {
+protected:
+  using PathType = typename Approx::PathType;
+
+  const PathType m_circlePath{Approx::approximate(this->m_circle.radius())};
+  const Transform<Approx::Queries::s_val> m_circleTransform{
+      std::make_shared<PathType>(m_circlePath)};
+};
+
+TYPED_TEST_SUITE_P(PathCircleApproxTest);
+
+TYPED_TEST_P(PathCircleApproxTest, GetPointsCircle) {
+  constexpr CircleTolerances tolerances{TypeParam::s_tolerances};
+  const auto pointsEst{this->m_circlePath(this->m_posFrenet.x())};
+  const auto pointsGtr{this->m_circle(this->m_posFrenet.x())};
+
+  this->expectAllClose(pointsEst.x(), pointsGtr.x(), tolerances.points);
+  this->expectAllClose(pointsEst.y(), pointsGtr.y(), tolerances.points);
+}
+
+TYPED_TEST_P(PathCircleApproxTest, GetAnglesCircle) {
+  constexpr CircleTolerances tolerances{TypeParam::s_tolerances};
+  const auto tangentsEst{this->m_circlePath.tangent(this->m_posFrenet.x())};
+  const auto tangentsGtr{this->m_circle.tangent(this->m_posFrenet.x())};
+  this->expectAllClose(tangentsEst.x(), tangentsGtr.x(), tolerances.tangents);
+  this->expectAllClose(tangentsEst.y(), tangentsGtr.y(), tolerances.tangents);
+
+  const auto angles1Est{this->m_circlePath.angle1(this->m_posFrenet.x())};
+  const auto angles1Gtr{this->m_circle.angle1(this->m_posFrenet.x())};
+  this->expectAllClose(angles1Est, angles1Gtr, tolerances.angles1);
+
+  const auto angles2Est{this->m_circlePath.angle2(this->m_posFrenet.x())};
+  const auto angles2Gtr{this->m_circle.angle2(this->m_posFrenet.x())};
+  this->expectAllClose(angles2Est, angles2Gtr, tolerances.angles2);
+}
+
+TYPED_TEST_P(PathCircleApproxTest, GetFramesCircle) {
+  constexpr CircleTolerances tolerances{TypeParam::s_tolerances};
+  const auto &lengths{this->m_posFrenet.x()};
+  const auto frames{this->m_circlePath.frames(lengths)};
+
+  // single pass must provide the properties of separate evaluations
+  const auto points{this->m_circlePath(lengths)};
+  const auto normals{this->m_circlePath.normal(lengths)};
+  this->expectAllClose(frames.points.x(), points.x(), limits::min());
+  this->expectAllClose(frames.points.y(), points.y(), limits::min());
+  this->expectAllClose(frames.normals.x(), normals.x(), 1e-14);
+  this->expectAllClose(frames.normals.y(), normals.y(), 1e-14);
+  this->expectAllClose(frames.curvatures, this->m_circlePath.angle1(lengths),
+                       1e-14);
+  this->expectAllClose(frames.curvatureRates,
+                       this->m_circlePath.angle2(lengths),
+                       tolerances.curvatureRates);
+}
+
+TYPED_TEST_P(PathCircleApproxTest, NextPointsCircle) {
+  constexpr CircleTolerances tolerances{TypeParam::s_tolerances};
+  const auto lengthsEst{this->m_circlePath.lengths(this->m_posCartes)};
+
+  this->expectAllClose(lengthsEst, this->m_posFrenet.x(), tolerances.lengths);
+}
+
+TYPED_TEST_P(PathCircleApproxTest, NextPointsHintCircle) {
+  const auto lengthsGtr{this->m_circlePath.lengths(this->m_posCartes)};
+  // hints deviate from previous lengths by small displacements
+  const typename TestFixture::ArrayQueries hints{
+      lengthsGtr +
+      TestFixture::ArrayQueries::Random(this->s_numQueries) * 1e-2};
+  const auto lengthsEst{
+      this->m_circlePath.lengths(this->m_posCartes, hints, 5e-2)};
+
+  // local search must provide the lengths of the search over all segments
+  this->expectAllClose(lengthsEst, lengthsGtr, 1e-12);
+}
+
+TYPED_TEST_P(PathCircleApproxTest, SinglePointCircle) {
+  constexpr CircleTolerances tolerances{TypeParam::s_tolerances};
+  for (int index{}; index < this->s_numQueries; ++index) {
+    const double lengthEst{this->m_circlePath.length(this->m_posCartes(index))};
+    EXPECT_NEAR(lengthEst, this->m_posFrenet.x(index), tolerances.lengths);
+  }
+}
+
+TYPED_TEST_P(PathCircleApproxTest, PosFrenetCircle) {
+  constexpr CircleTolerances tolerances{TypeParam::s_tolerances};
+  const auto posFrenet{this->m_circleTransform.posFrenet(this->m_posCartes)};
+
+  this->expectAllClose(posFrenet.x(), this->m_posFrenet.x(),
+                       tolerances.posFrenet);
+  this->expectAllClose(posFrenet.y(), this->m_posFrenet.y(),
+                       tolerances.posFrenet);
+}
+
+TYPED_TEST_P(PathCircleApproxTest, VelFrenetCircle) {
+  constexpr CircleTolerances tolerances{TypeParam::s_tolerances};
+  // test frenet frame results since error grows with distance from path
+  const auto velFrenet{
+      this->m_circleTransform.velFrenet(this->m_velCartes, this->m_posFrenet)};
+
+  this->expectAllClose(velFrenet.x(), this->m_velFrenet.x(),
+                       tolerances.velFrenet);
+  this->expectAllClose(velFrenet.y(), this->m_velFrenet.y(),
+                       tolerances.velFrenet);
+}
+
+TYPED_TEST_P(PathCircleApproxTest, AccFrenetCircle) {
+  constexpr CircleTolerances tolerances{TypeParam::s_tolerances};
+  const auto accFrenet{this->m_circleTransform.accFrenet(
+      this->m_accCartes, this->m_velFrenet, this->m_posFrenet)};
+
+  this->expectAllClose(accFrenet.x(), this->m_accFrenet.x(),
+                       tolerances.accFrenet);
+  this->expectAllClose(accFrenet.y(), this->m_accFrenet.y(),
+                       tolerances.accFrenet);
+}
+
+TYPED_TEST_P(PathCircleApproxTest, AccCartCircle) {
+  constexpr CircleTolerances tolerances{TypeParam::s_tolerances};
+  const auto accCartes{this->m_circleTransform.accCartes(
+      this->m_accFrenet, this->m_velFrenet, this->m_posFrenet)};
+
+  this->expectAllClose(accCartes.x(), this->m_accCartes.x(),
+                       tolerances.accCartes);
+  this->expectAllClose(accCartes.y(), this->m_accCartes.y(),
+                       tolerances.accCartes);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(PathCircleApproxTest, GetPointsCircle,
+                            GetAnglesCircle, GetFramesCircle, NextPointsCircle,
+                            NextPointsHintCircle, SinglePointCircle,
+                            PosFrenetCircle, VelFrenetCircle, AccFrenetCircle,
+                            AccCartCircle);
+}; // namespace Internal
+}; // namespace FrenetTransform
+
+#endif
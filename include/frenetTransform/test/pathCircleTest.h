@@ -1,3 +1,6 @@
+#ifndef PATH_CIRCLE_TEST_H
+#define PATH_CIRCLE_TEST_H
+
 #include "frenetTransform/internal/circle.h"
 #include "frenetTransform/internal/transformCircle.h"
 #include "frenetTransform/points.h"
@@ -30,5 +33,39 @@ protected:
   const Points<NumQueries::s_val> m_posFrenet{
       m_transform.posFrenet(m_posCircle)};
 };
+
+/**
+ * @brief Positions, velocities and accelerations of the queries around the
+ * circle in each coordinate system.
+ *
+ * @tparam NumQueries number of query points.
+ */
+template <typename NumQueries>
+class PathCircleStateTest : public PathCircleTest<NumQueries> {
+public:
+  using ArrayQueries = Eigen::Array<double, NumQueries::s_val, 1>;
+
+protected:
+  const Points<NumQueries::s_val> m_posCartes{
+      this->m_transform.posCartes(this->m_posCircle)};
+
+  const Points<NumQueries::s_val, PointCircle> m_velCircle{
+      ArrayQueries::Random(this->s_numQueries).abs() * this->m_circle.radius(),
+      ArrayQueries::Random(this->s_numQueries) * M_PI / 4};
+  const Points<NumQueries::s_val> m_velCartes{
+      this->m_transform.velCartes(this->m_velCircle, this->m_posCircle)};
+  const Points<NumQueries::s_val> m_velFrenet{
+      this->m_transform.velFrenet(this->m_velCircle)};
+
+  const Points<NumQueries::s_val, PointCircle> m_accCircle{
+      ArrayQueries::Random(this->s_numQueries).abs() * this->m_circle.radius(),
+      ArrayQueries::Random(this->s_numQueries) * M_PI / 4};
+  const Points<NumQueries::s_val> m_accCartes{this->m_transform.accCartes(
+      this->m_accCircle, this->m_velCircle, this->m_posCircle)};
+  const Points<NumQueries::s_val> m_accFrenet{
+      this->m_transform.accFrenet(this->m_accCircle)};
+};
 }; // namespace Internal
-}; // namespace FrenetTransform
\ No newline at end of file
+}; // namespace FrenetTransform
+
+#endif
\ No newline at end of file
@@ -22,7 +22,8 @@ protected:
     for (int idx{}; idx < estimate.size(); ++idx) {
       EXPECT_LT(errAbsVals(idx), errAbs)
           << "Error bound violated at index " << idx << '!';
-      if (!std::isinf(errRelVals(idx)))
+      // relative errors undefined for zero ground truth
+      if (std::isfinite(errRelVals(idx)))
         EXPECT_LT(errRelVals(idx), errRel)
             << "Error bound violated at index " << idx << '!';
     }
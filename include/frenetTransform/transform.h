@@ -3,22 +3,163 @@
 
 #include <Eigen/Core>
 #include <memory>
+#include <type_traits>
 
-#include "frenetTransform/internal/math.h"
+#include "frenetTransform/frameSet.h"
+#include "frenetTransform/frames.h"
+#include "frenetTransform/internal/matrices2.h"
 #include "frenetTransform/path.h"
 #include "frenetTransform/points.h"
 
 namespace FrenetTransform {
+/**
+ * @brief Positions, velocities and accelerations of objects in either
+ * Cartesian or Frenet coordinates.
+ *
+ * @tparam NumQueries number of query points with -1 for dynamic point number.
+ * @tparam Scalar floating point type of the states.
+ */
+template <int NumQueries = Eigen::Dynamic, typename Scalar = double>
+struct States {
+  using PointsQueries = Points<NumQueries, BasicPoint<Scalar>>;
+
+  PointsQueries pos{}; /**<< positions */
+  PointsQueries vel{}; /**<< velocities */
+  PointsQueries acc{}; /**<< accelerations */
+};
+
+/**
+ * @brief Position, velocity and acceleration of a single object in either
+ * Cartesian or Frenet coordinates.
+ *
+ * @tparam Scalar floating point type of the state.
+ */
+template <typename Scalar = double> struct State {
+  BasicPoint<Scalar> pos{}; /**<< position */
+  BasicPoint<Scalar> vel{}; /**<< velocity */
+  BasicPoint<Scalar> acc{}; /**<< acceleration */
+};
+
+/**
+ * @brief Jacobians of a transformation with respect to its inputs, as one
+ * 2x2 block per query point. Rows correspond to the x- and y-coordinates of
+ * the results and columns to those of the inputs. Blocks not determined by a
+ * transformation remain unchanged.
+ *
+ * @tparam NumQueries number of query points with -1 for dynamic point number.
+ * @tparam Scalar floating point type of the Jacobians.
+ */
+template <int NumQueries = Eigen::Dynamic, typename Scalar = double>
+struct Jacobians {
+  using Matrices = Internal::Matrices2<NumQueries, Scalar>;
+
+  Matrices pos{};      /**<< positions by input positions */
+  Matrices velByVel{}; /**<< velocities by input velocities */
+  Matrices velByPos{}; /**<< velocities by input positions */
+};
+
+template <int NumQueries, typename PathType> class Transform;
+
+/**
+ * @brief Scratch arrays of a Transform reused between calls.
+ * Eigen arrays reallocate whenever their size changes, so the workspace is
+ * sized to a fixed number of query points. Callers with a varying number of
+ * objects pad their queries to this maximum number to avoid allocations.
+ *
+ * @tparam NumQueries number of query points with -1 for dynamic point number.
+ * @tparam Scalar floating point type of the scratch arrays.
+ */
+template <int NumQueries = Eigen::Dynamic, typename Scalar = double>
+class TransformWorkspace {
+public:
+  using ArrayQueries = Eigen::Array<Scalar, NumQueries, 1>;
+
+  TransformWorkspace() = default;
+
+  /**
+   * @brief Construct a new TransformWorkspace for "numQueries" query points.
+   *
+   * @param numQueries number of query points per call.
+   */
+  explicit TransformWorkspace(int numQueries) { resize(numQueries); }
+
+  /**
+   * @brief Resize all scratch arrays to "numQueries" query points.
+   *
+   * @param numQueries number of query points per call.
+   */
+  void resize(int numQueries) {
+    m_lengths.resize(numQueries);
+    m_frames.points.resize(numQueries);
+    m_frames.tangents.resize(numQueries);
+    m_frames.normals.resize(numQueries);
+    m_frames.curvatures.resize(numQueries);
+    m_frames.curvatureRates.resize(numQueries);
+    m_velTransforms.resize(numQueries);
+    m_accTransforms.resize(numQueries);
+  }
+
+  /**
+   * @brief Provide the number of query points the workspace is sized for.
+   *
+   * @return int number of query points.
+   */
+  int numQueries() const { return m_lengths.rows(); }
+
+private:
+  template <int, typename> friend class Transform;
+
+  ArrayQueries m_lengths{};              /**<< lengths of the projections */
+  Frames<NumQueries, Scalar> m_frames{}; /**<< path properties at the lengths */
+  // transformation matrices from Frenet to Cartesian velocities
+  Internal::Matrices2<NumQueries, Scalar> m_velTransforms{};
+  // transformation matrices to velocity-induced accelerations
+  Internal::Matrices2<NumQueries, Scalar> m_accTransforms{};
+};
+
 /**
  * @brief Transformation between Cartesian and Frenet frame.
  * Use the Path properties to implement the transformation independent from the
  * Path implementation.
  *
+ * Each transformation is also provided with caller-owned results and a
+ * TransformWorkspace. These overloads do not allocate if the results and the
+ * workspace are sized to the number of query points and the path evaluates
+ * without allocation. Results must not alias the inputs.
+ *
+ * By default, the path is called through the virtual Path interface, such that
+ * one Transform type serves all paths. A concrete PathType binds the calls at
+ * compile time instead, such that the path evaluation inlines into the
+ * transformations, e.g. Transform<NumQueries, Polychain<NumPoints,
+ * NumQueries>>.
+ *
+ * The floating point type of queries, results and workspace follows the
+ * Scalar of the path, e.g. Transform<NumQueries, Path<NumQueries, float>>
+ * transforms single precision states.
+ *
+ * Single objects are transformed with the Point overloads, which evaluate the
+ * path at a single length with scalar arithmetic instead of arrays and do not
+ * allocate for paths with a scalar evaluation such as Polychain.
+ *
  * @tparam NumQueries number of query points with -1 for dynamic point number.
+ * @tparam PathType type of the path, Path<NumQueries, Scalar> or a class
+ * derived from it.
  */
-template <int NumQueries = Eigen::Dynamic> class Transform {
+template <int NumQueries = Eigen::Dynamic,
+          typename PathType = Path<NumQueries>>
+class Transform {
 public:
-  using ArrayQueries = Eigen::Array<double, NumQueries, 1>;
+  using Scalar = typename PathType::Scalar;
+  using Point = BasicPoint<Scalar>;
+  using ArrayQueries = Eigen::Array<Scalar, NumQueries, 1>;
+  using PointsQueries = Points<NumQueries, BasicPoint<Scalar>>;
+  using StatesQueries = States<NumQueries, Scalar>;
+  using Workspace = TransformWorkspace<NumQueries, Scalar>;
+  using JacobiansQueries = Jacobians<NumQueries, Scalar>;
+  using FrameSetQueries = FrameSet<NumQueries, Scalar>;
+
+  static_assert(std::is_base_of_v<Path<NumQueries, Scalar>, PathType>,
+                "PathType must implement Path<NumQueries, Scalar>");
 
   Transform() = default;
 
@@ -27,7 +168,7 @@ public:
    *
    * @param path defines the Frenet frame.
    */
-  Transform(const std::shared_ptr<Path<NumQueries>> path) : m_path{path} {}
+  Transform(const std::shared_ptr<PathType> path) : m_path{path} {}
 
   /**
    * @brief Transform Cartesian positions to Frenet positions.
@@ -36,32 +177,96 @@ public:
    * projections. Determines the signed shortest distances to the query point.
    *
    * @param posCartes query points in Cartesian coordinates.
-   * @return Points<NumQueries> resut points in Frenet coordinates.
+   * @return PointsQueries resut points in Frenet coordinates.
+   */
+  PointsQueries posFrenet(const PointsQueries &posCartes) const {
+    PointsQueries result{};
+    Workspace workspace{};
+    posFrenet(posCartes, result, workspace);
+    return result;
+  }
+
+  /**
+   * @brief Transform Cartesian positions to Frenet positions into
+   * caller-provided results.
+   *
+   * @param posCartes query points in Cartesian coordinates.
+   * @param result points in Frenet coordinates.
+   * @param workspace scratch arrays reused between calls.
    */
-  Points<NumQueries> posFrenet(const Points<NumQueries> &posCartes) const {
+  void posFrenet(const PointsQueries &posCartes, PointsQueries &result,
+                 Workspace &workspace) const {
     // lengths from path origin to Cartesian positions
-    const auto lengths{m_path->lengths(posCartes)};
-    // next points on path to Cartesian positions
-    const auto posPath{m_path->operator()(lengths)};
-    // vectors from query points to path points
-    const auto posDiff{posCartes - posPath};
-    // normal vectors on path
-    const auto normals{m_path->normal(lengths)};
-    return {lengths, normals * posDiff};
+    m_path->lengths(posCartes, workspace.m_lengths);
+    posFrenetAt(posCartes, result, workspace);
+  }
+
+  /**
+   * @brief Transform Cartesian positions to Frenet positions close to previous
+   * lengths. Tracked query points search the path locally around their
+   * previous lengths.
+   *
+   * @param posCartes query points in Cartesian coordinates.
+   * @param hints previous lengths along the path for each query point.
+   * @param window maximum length difference to the hints searched locally.
+   * @return PointsQueries result points in Frenet coordinates.
+   */
+  PointsQueries posFrenet(const PointsQueries &posCartes,
+                          const ArrayQueries &hints, Scalar window) const {
+    PointsQueries result{};
+    Workspace workspace{};
+    posFrenet(posCartes, hints, window, result, workspace);
+    return result;
+  }
+
+  /**
+   * @brief Transform Cartesian positions to Frenet positions close to previous
+   * lengths into caller-provided results. The hints may be the lengths of the
+   * previous results.
+   *
+   * @param posCartes query points in Cartesian coordinates.
+   * @param hints previous lengths along the path for each query point.
+   * @param window maximum length difference to the hints searched locally.
+   * @param result points in Frenet coordinates.
+   * @param workspace scratch arrays reused between calls.
+   */
+  void posFrenet(const PointsQueries &posCartes, const ArrayQueries &hints,
+                 Scalar window, PointsQueries &result,
+                 Workspace &workspace) const {
+    // lengths from path origin to Cartesian positions
+    m_path->lengths(posCartes, hints, window, workspace.m_lengths);
+    posFrenetAt(posCartes, result, workspace);
   }
 
   /**
    * @brief Transform Frenet positions to Cartesian positions.
    *
    * @param posFrenet query points in Frenet coordinates.
-   * @return Points<NumQueries> result points in Cartesian coordinates.
+   * @return PointsQueries result points in Cartesian coordinates.
    */
-  Points<NumQueries> posCartes(const Points<NumQueries> &posFrenet) const {
-    // positions along the path at the signed lenghts from the origin
-    const auto posPath{m_path->operator()(posFrenet.x())};
-    // normals along the path pointing toward or away from the Cartesian point
-    const auto normals{m_path->normal(posFrenet.x())};
-    return posPath + normals * posFrenet.y();
+  PointsQueries posCartes(const PointsQueries &posFrenet) const {
+    PointsQueries result{};
+    Workspace workspace{};
+    posCartes(posFrenet, result, workspace);
+    return result;
+  }
+
+  /**
+   * @brief Transform Frenet positions to Cartesian positions into
+   * caller-provided results.
+   *
+   * @param posFrenet query points in Frenet coordinates.
+   * @param result points in Cartesian coordinates.
+   * @param workspace scratch arrays reused between calls.
+   */
+  void posCartes(const PointsQueries &posFrenet, PointsQueries &result,
+                 Workspace &workspace) const {
+    // positions and normals along the path at the signed lenghts from the
+    // origin, normals point toward or away from the Cartesian point
+    auto &frames{workspace.m_frames};
+    m_path->frames(posFrenet.x(), FramePoints | FrameTangents, frames);
+    result.x() = frames.points.x() + frames.normals.x() * posFrenet.y();
+    result.y() = frames.points.y() + frames.normals.y() * posFrenet.y();
   }
 
   /**
@@ -70,18 +275,35 @@ public:
    * @param velCartes query velocities in Cartesian coordinates.
    * @param posFrenet positions corresponding to velocities in Frenet
    * coordinates.
-   * @return Points<NumQueries> result velocities in Frenet coordinates.
+   * @return PointsQueries result velocities in Frenet coordinates.
+   */
+  PointsQueries velFrenet(const PointsQueries &velCartes,
+                          const PointsQueries &posFrenet) const {
+    PointsQueries result{};
+    Workspace workspace{};
+    velFrenet(velCartes, posFrenet, result, workspace);
+    return result;
+  }
+
+  /**
+   * @brief Transform Cartesian velocities to Frenet velocities into
+   * caller-provided results.
+   *
+   * @param velCartes query velocities in Cartesian coordinates.
+   * @param posFrenet positions corresponding to velocities in Frenet
+   * coordinates.
+   * @param result velocities in Frenet coordinates.
+   * @param workspace scratch arrays reused between calls.
    */
-  Points<NumQueries> velFrenet(const Points<NumQueries> &velCartes,
-                               const Points<NumQueries> &posFrenet) const {
+  void velFrenet(const PointsQueries &velCartes, const PointsQueries &posFrenet,
+                 PointsQueries &result, Workspace &workspace) const {
     // transformation matrices from Cartesian to Frenet frames at given Frenet
     // frame positions
-    const auto velTransformsInv{transformInv(velTransform(posFrenet))};
-    // matrix-vector multiplications of transformations with velocities
-    return {velTransformsInv(0, 0) * velCartes.x() +
-                velTransformsInv(0, 1) * velCartes.y(),
-            velTransformsInv(1, 0) * velCartes.x() +
-                velTransformsInv(1, 1) * velCartes.y()};
+    m_path->frames(posFrenet.x(), FrameTangents | FrameCurvatures,
+                   workspace.m_frames);
+    velTransform(workspace.m_frames, posFrenet, workspace.m_velTransforms);
+    // solve the velocity transformations for the Cartesian velocities
+    workspace.m_velTransforms.inverseApply(velCartes, result);
   }
 
   /**
@@ -90,18 +312,35 @@ public:
    * @param velFrenet query velocities in Frenet coordinates.
    * @param posFrenet positions corresponding to velocities in Frenet
    * coordinates.
-   * @return Points<NumQueries> result velocities in Cartesian coordinates.
+   * @return PointsQueries result velocities in Cartesian coordinates.
+   */
+  PointsQueries velCartes(const PointsQueries &velFrenet,
+                          const PointsQueries &posFrenet) const {
+    PointsQueries result{};
+    Workspace workspace{};
+    velCartes(velFrenet, posFrenet, result, workspace);
+    return result;
+  }
+
+  /**
+   * @brief Transform Frenet velocities to Cartesian velocities into
+   * caller-provided results.
+   *
+   * @param velFrenet query velocities in Frenet coordinates.
+   * @param posFrenet positions corresponding to velocities in Frenet
+   * coordinates.
+   * @param result velocities in Cartesian coordinates.
+   * @param workspace scratch arrays reused between calls.
    */
-  Points<NumQueries> velCartes(const Points<NumQueries> &velFrenet,
-                               const Points<NumQueries> &posFrenet) const {
+  void velCartes(const PointsQueries &velFrenet, const PointsQueries &posFrenet,
+                 PointsQueries &result, Workspace &workspace) const {
     // transformation matrices from Frenet to Cartesian frames at given Frenet
     // frame positions
-    const auto velTransforms{velTransform(posFrenet)};
+    m_path->frames(posFrenet.x(), FrameTangents | FrameCurvatures,
+                   workspace.m_frames);
+    velTransform(workspace.m_frames, posFrenet, workspace.m_velTransforms);
     // matrix-vector multiplications of transformations with velocities
-    return {velTransforms(0, 0) * velFrenet.x() +
-                velTransforms(0, 1) * velFrenet.y(),
-            velTransforms(1, 0) * velFrenet.x() +
-                velTransforms(1, 1) * velFrenet.y()};
+    evaluate(workspace.m_velTransforms.apply(velFrenet), result);
   }
 
   /**
@@ -112,29 +351,40 @@ public:
    * coordinates.
    * @param posFrenet positions corresponding to accelerations in Frenet
    * coordinates.
-   * @return Points<NumQueries> result accelerations in Frenet coordinates.
+   * @return PointsQueries result accelerations in Frenet coordinates.
    */
-  Points<NumQueries> accFrenet(const Points<NumQueries> &accCartes,
-                               const Points<NumQueries> &velFrenet,
-                               const Points<NumQueries> &posFrenet) const {
-    // transformation matrices to determine Cartesian acceleration induced by
-    // Frenet velocities
-    const auto accTransforms{accTransform(velFrenet, posFrenet)};
-    // difference between query accelerations and velocity-induced accelerations
-    const Points<NumQueries> accDiff{
-        accCartes.x() - accTransforms(0, 0) * velFrenet.x() -
-            accTransforms(0, 1) * velFrenet.y(),
-        accCartes.y() - accTransforms(1, 0) * velFrenet.x() -
-            accTransforms(1, 1) * velFrenet.y()};
+  PointsQueries accFrenet(const PointsQueries &accCartes,
+                          const PointsQueries &velFrenet,
+                          const PointsQueries &posFrenet) const {
+    PointsQueries result{};
+    Workspace workspace{};
+    accFrenet(accCartes, velFrenet, posFrenet, result, workspace);
+    return result;
+  }
+
+  /**
+   * @brief Transform Cartesian accelerations to Frenet accelerations into
+   * caller-provided results.
+   *
+   * @param accCartes query accelerations in Cartesian coordinates.
+   * @param velFrenet velocities corresponding to accelerations in Frenet
+   * coordinates.
+   * @param posFrenet positions corresponding to accelerations in Frenet
+   * coordinates.
+   * @param result accelerations in Frenet coordinates.
+   * @param workspace scratch arrays reused between calls.
+   */
+  void accFrenet(const PointsQueries &accCartes, const PointsQueries &velFrenet,
+                 const PointsQueries &posFrenet, PointsQueries &result,
+                 Workspace &workspace) const {
+    // path properties shared by all transformations
+    m_path->frames(posFrenet.x(),
+                   FrameTangents | FrameCurvatures | FrameCurvatureRates,
+                   workspace.m_frames);
     // transformation matrices from Cartesian to Frenet frames at given Frenet
     // frame positions
-    const auto velTransformsInv{transformInv(velTransform(posFrenet))};
-    // matrix-vector multiplications of transformations with velocity
-    // differences
-    return {velTransformsInv(0, 0) * accDiff.x() +
-                velTransformsInv(0, 1) * accDiff.y(),
-            velTransformsInv(1, 0) * accDiff.x() +
-                velTransformsInv(1, 1) * accDiff.y()};
+    velTransform(workspace.m_frames, posFrenet, workspace.m_velTransforms);
+    accFrenetAt(accCartes, velFrenet, posFrenet, result, workspace);
   }
 
   /**
@@ -145,77 +395,816 @@ public:
    * coordinates.
    * @param posFrenet positions corresponding to accelerations in Frenet
    * coordinates.
-   * @return Points<NumQueries> result accelerations in Cartesian coordinates.
+   * @return PointsQueries result accelerations in Cartesian coordinates.
    */
-  Points<NumQueries> accCartes(const Points<NumQueries> &accFrenet,
-                               const Points<NumQueries> &velFrenet,
-                               const Points<NumQueries> &posFrenet) const {
-    // transformation matrices to determine Cartesian acceleration induced by
-    // Frenet velocities
-    const auto accTransforms{accTransform(velFrenet, posFrenet)};
+  PointsQueries accCartes(const PointsQueries &accFrenet,
+                          const PointsQueries &velFrenet,
+                          const PointsQueries &posFrenet) const {
+    PointsQueries result{};
+    Workspace workspace{};
+    accCartes(accFrenet, velFrenet, posFrenet, result, workspace);
+    return result;
+  }
+
+  /**
+   * @brief Transform Frenet accelerations to Cartesian accelerations into
+   * caller-provided results.
+   *
+   * @param accFrenet query accelerations in Frenet coordinates.
+   * @param velFrenet velocities corresponding to accelerations in Frenet
+   * coordinates.
+   * @param posFrenet positions corresponding to accelerations in Frenet
+   * coordinates.
+   * @param result accelerations in Cartesian coordinates.
+   * @param workspace scratch arrays reused between calls.
+   */
+  void accCartes(const PointsQueries &accFrenet, const PointsQueries &velFrenet,
+                 const PointsQueries &posFrenet, PointsQueries &result,
+                 Workspace &workspace) const {
+    // path properties shared by all transformations
+    m_path->frames(posFrenet.x(),
+                   FrameTangents | FrameCurvatures | FrameCurvatureRates,
+                   workspace.m_frames);
     // transformation matrices from Frenet to Cartesian frames at given Frenet
     // frame positions
-    const auto velTransforms{velTransform(posFrenet)};
-    // sum of velocity-induced accelerations and transformed Frenet
-    // accelerations
-    return {velTransforms(0, 0) * accFrenet.x() +
-                velTransforms(0, 1) * accFrenet.y() +
-                accTransforms(0, 0) * velFrenet.x() +
-                accTransforms(0, 1) * velFrenet.y(),
-            velTransforms(1, 0) * accFrenet.x() +
-                velTransforms(1, 1) * accFrenet.y() +
-                accTransforms(1, 0) * velFrenet.x() +
-                accTransforms(1, 1) * velFrenet.y()};
+    velTransform(workspace.m_frames, posFrenet, workspace.m_velTransforms);
+    accCartesAt(accFrenet, velFrenet, posFrenet, result, workspace);
+  }
+
+  /**
+   * @brief Transform Cartesian states to Frenet states.
+   * Projects the query points onto the path and evaluates the path properties
+   * and transformation matrices once for positions, velocities and
+   * accelerations.
+   *
+   * @param posCartes query positions in Cartesian coordinates.
+   * @param velCartes query velocities in Cartesian coordinates.
+   * @param accCartes query accelerations in Cartesian coordinates.
+   * @return StatesQueries result states in Frenet coordinates.
+   */
+  StatesQueries stateFrenet(const PointsQueries &posCartes,
+                            const PointsQueries &velCartes,
+                            const PointsQueries &accCartes) const {
+    StatesQueries result{};
+    Workspace workspace{};
+    stateFrenet(posCartes, velCartes, accCartes, result, workspace);
+    return result;
+  }
+
+  /**
+   * @brief Transform Cartesian states to Frenet states into caller-provided
+   * results.
+   *
+   * @param posCartes query positions in Cartesian coordinates.
+   * @param velCartes query velocities in Cartesian coordinates.
+   * @param accCartes query accelerations in Cartesian coordinates.
+   * @param result states in Frenet coordinates.
+   * @param workspace scratch arrays reused between calls.
+   */
+  void stateFrenet(const PointsQueries &posCartes,
+                   const PointsQueries &velCartes,
+                   const PointsQueries &accCartes, StatesQueries &result,
+                   Workspace &workspace) const {
+    // lengths from path origin to Cartesian positions
+    m_path->lengths(posCartes, workspace.m_lengths);
+    stateFrenetAt(posCartes, velCartes, accCartes, result, workspace);
+  }
+
+  /**
+   * @brief Transform Cartesian states to Frenet states close to previous
+   * lengths. Tracked query points search the path locally around their
+   * previous lengths.
+   *
+   * @param posCartes query positions in Cartesian coordinates.
+   * @param velCartes query velocities in Cartesian coordinates.
+   * @param accCartes query accelerations in Cartesian coordinates.
+   * @param hints previous lengths along the path for each query point.
+   * @param window maximum length difference to the hints searched locally.
+   * @return StatesQueries result states in Frenet coordinates.
+   */
+  StatesQueries stateFrenet(const PointsQueries &posCartes,
+                            const PointsQueries &velCartes,
+                            const PointsQueries &accCartes,
+                            const ArrayQueries &hints, Scalar window) const {
+    StatesQueries result{};
+    Workspace workspace{};
+    stateFrenet(posCartes, velCartes, accCartes, hints, window, result,
+                workspace);
+    return result;
+  }
+
+  /**
+   * @brief Transform Cartesian states to Frenet states close to previous
+   * lengths into caller-provided results. The hints may be the lengths of the
+   * previous results.
+   *
+   * @param posCartes query positions in Cartesian coordinates.
+   * @param velCartes query velocities in Cartesian coordinates.
+   * @param accCartes query accelerations in Cartesian coordinates.
+   * @param hints previous lengths along the path for each query point.
+   * @param window maximum length difference to the hints searched locally.
+   * @param result states in Frenet coordinates.
+   * @param workspace scratch arrays reused between calls.
+   */
+  void stateFrenet(const PointsQueries &posCartes,
+                   const PointsQueries &velCartes,
+                   const PointsQueries &accCartes, const ArrayQueries &hints,
+                   Scalar window, StatesQueries &result,
+                   Workspace &workspace) const {
+    // lengths from path origin to Cartesian positions
+    m_path->lengths(posCartes, hints, window, workspace.m_lengths);
+    stateFrenetAt(posCartes, velCartes, accCartes, result, workspace);
+  }
+
+  /**
+   * @brief Transform Frenet states to Cartesian states.
+   * Evaluates the path properties and transformation matrices once for
+   * positions, velocities and accelerations.
+   *
+   * @param posFrenet query positions in Frenet coordinates.
+   * @param velFrenet query velocities in Frenet coordinates.
+   * @param accFrenet query accelerations in Frenet coordinates.
+   * @return StatesQueries result states in Cartesian coordinates.
+   */
+  StatesQueries stateCartes(const PointsQueries &posFrenet,
+                            const PointsQueries &velFrenet,
+                            const PointsQueries &accFrenet) const {
+    StatesQueries result{};
+    Workspace workspace{};
+    stateCartes(posFrenet, velFrenet, accFrenet, result, workspace);
+    return result;
+  }
+
+  /**
+   * @brief Transform Frenet states to Cartesian states into caller-provided
+   * results.
+   *
+   * @param posFrenet query positions in Frenet coordinates.
+   * @param velFrenet query velocities in Frenet coordinates.
+   * @param accFrenet query accelerations in Frenet coordinates.
+   * @param result states in Cartesian coordinates.
+   * @param workspace scratch arrays reused between calls.
+   */
+  void stateCartes(const PointsQueries &posFrenet,
+                   const PointsQueries &velFrenet,
+                   const PointsQueries &accFrenet, StatesQueries &result,
+                   Workspace &workspace) const {
+    // all path properties at the signed lengths from the origin
+    auto &frames{workspace.m_frames};
+    m_path->frames(posFrenet.x(), FrameAll, frames);
+    result.pos.x() = frames.points.x() + frames.normals.x() * posFrenet.y();
+    result.pos.y() = frames.points.y() + frames.normals.y() * posFrenet.y();
+
+    // transformation matrices from Frenet to Cartesian frames
+    velTransform(frames, posFrenet, workspace.m_velTransforms);
+    evaluate(workspace.m_velTransforms.apply(velFrenet), result.vel);
+    accCartesAt(accFrenet, velFrenet, posFrenet, result.acc, workspace);
+  }
+
+  /**
+   * @brief Transform Cartesian positions to Frenet positions with the
+   * Jacobians of the Frenet positions by the Cartesian positions.
+   *
+   * @param posCartes query points in Cartesian coordinates.
+   * @param jacobians Jacobians with the position blocks determined.
+   * @return PointsQueries result points in Frenet coordinates.
+   */
+  PointsQueries posFrenet(const PointsQueries &posCartes,
+                          JacobiansQueries &jacobians) const {
+    PointsQueries result{};
+    Workspace workspace{};
+    posFrenet(posCartes, result, jacobians, workspace);
+    return result;
+  }
+
+  /**
+   * @brief Transform Cartesian positions to Frenet positions with their
+   * Jacobians into caller-provided results. The Jacobians are the inverse
+   * velocity transformations at the projections, as the Frenet frame moves
+   * along the path.
+   *
+   * @param posCartes query points in Cartesian coordinates.
+   * @param result points in Frenet coordinates.
+   * @param jacobians Jacobians with the position blocks determined.
+   * @param workspace scratch arrays reused between calls.
+   */
+  void posFrenet(const PointsQueries &posCartes, PointsQueries &result,
+                 JacobiansQueries &jacobians, Workspace &workspace) const {
+    // lengths from path origin to Cartesian positions
+    m_path->lengths(posCartes, workspace.m_lengths);
+    auto &frames{workspace.m_frames};
+    m_path->frames(workspace.m_lengths,
+                   FramePoints | FrameTangents | FrameCurvatures, frames);
+    result.x() = workspace.m_lengths;
+    result.y() = frames.normals.x() * (posCartes.x() - frames.points.x()) +
+                 frames.normals.y() * (posCartes.y() - frames.points.y());
+
+    velTransform(frames, result, workspace.m_velTransforms);
+    workspace.m_velTransforms.inverse(jacobians.pos);
+  }
+
+  /**
+   * @brief Transform Frenet positions to Cartesian positions with the
+   * Jacobians of the Cartesian positions by the Frenet positions.
+   *
+   * @param posFrenet query points in Frenet coordinates.
+   * @param jacobians Jacobians with the position blocks determined.
+   * @return PointsQueries result points in Cartesian coordinates.
+   */
+  PointsQueries posCartes(const PointsQueries &posFrenet,
+                          JacobiansQueries &jacobians) const {
+    PointsQueries result{};
+    Workspace workspace{};
+    posCartes(posFrenet, result, jacobians, workspace);
+    return result;
+  }
+
+  /**
+   * @brief Transform Frenet positions to Cartesian positions with their
+   * Jacobians into caller-provided results. The Jacobians are the velocity
+   * transformations.
+   *
+   * @param posFrenet query points in Frenet coordinates.
+   * @param result points in Cartesian coordinates.
+   * @param jacobians Jacobians with the position blocks determined.
+   * @param workspace scratch arrays reused between calls.
+   */
+  void posCartes(const PointsQueries &posFrenet, PointsQueries &result,
+                 JacobiansQueries &jacobians, Workspace &workspace) const {
+    auto &frames{workspace.m_frames};
+    m_path->frames(posFrenet.x(), FramePoints | FrameTangents | FrameCurvatures,
+                   frames);
+    result.x() = frames.points.x() + frames.normals.x() * posFrenet.y();
+    result.y() = frames.points.y() + frames.normals.y() * posFrenet.y();
+
+    velTransform(frames, posFrenet, jacobians.pos);
+  }
+
+  /**
+   * @brief Transform Cartesian velocities to Frenet velocities with the
+   * Jacobians of the Frenet velocities by the Cartesian velocities and by the
+   * Frenet positions.
+   *
+   * @param velCartes query velocities in Cartesian coordinates.
+   * @param posFrenet positions corresponding to velocities in Frenet
+   * coordinates.
+   * @param jacobians Jacobians with the velocity blocks determined.
+   * @return PointsQueries result velocities in Frenet coordinates.
+   */
+  PointsQueries velFrenet(const PointsQueries &velCartes,
+                          const PointsQueries &posFrenet,
+                          JacobiansQueries &jacobians) const {
+    PointsQueries result{};
+    Workspace workspace{};
+    velFrenet(velCartes, posFrenet, result, jacobians, workspace);
+    return result;
+  }
+
+  /**
+   * @brief Transform Cartesian velocities to Frenet velocities with their
+   * Jacobians into caller-provided results. Differentiating the inverse
+   * velocity transformations by the positions provides the negative inverse
+   * transformations applied to the Jacobians of the Cartesian velocities.
+   *
+   * @param velCartes query velocities in Cartesian coordinates.
+   * @param posFrenet positions corresponding to velocities in Frenet
+   * coordinates.
+   * @param result velocities in Frenet coordinates.
+   * @param jacobians Jacobians with the velocity blocks determined.
+   * @param workspace scratch arrays reused between calls.
+   */
+  void velFrenet(const PointsQueries &velCartes, const PointsQueries &posFrenet,
+                 PointsQueries &result, JacobiansQueries &jacobians,
+                 Workspace &workspace) const {
+    m_path->frames(posFrenet.x(),
+                   FrameTangents | FrameCurvatures | FrameCurvatureRates,
+                   workspace.m_frames);
+    velTransform(workspace.m_frames, posFrenet, workspace.m_velTransforms);
+    workspace.m_velTransforms.inverseApply(velCartes, result);
+
+    // Jacobians of Cartesian velocities by positions at the Frenet velocities
+    accTransform(workspace.m_frames, result, posFrenet,
+                 workspace.m_accTransforms);
+    workspace.m_velTransforms.inverse(jacobians.velByVel);
+    jacobians.velByVel.multiply(workspace.m_accTransforms, jacobians.velByPos);
+    for (int row{}; row < 2; ++row)
+      for (int col{}; col < 2; ++col)
+        jacobians.velByPos(row, col) = -jacobians.velByPos(row, col);
+  }
+
+  /**
+   * @brief Transform Frenet velocities to Cartesian velocities with the
+   * Jacobians of the Cartesian velocities by the Frenet velocities and by the
+   * Frenet positions.
+   *
+   * @param velFrenet query velocities in Frenet coordinates.
+   * @param posFrenet positions corresponding to velocities in Frenet
+   * coordinates.
+   * @param jacobians Jacobians with the velocity blocks determined.
+   * @return PointsQueries result velocities in Cartesian coordinates.
+   */
+  PointsQueries velCartes(const PointsQueries &velFrenet,
+                          const PointsQueries &posFrenet,
+                          JacobiansQueries &jacobians) const {
+    PointsQueries result{};
+    Workspace workspace{};
+    velCartes(velFrenet, posFrenet, result, jacobians, workspace);
+    return result;
+  }
+
+  /**
+   * @brief Transform Frenet velocities to Cartesian velocities with their
+   * Jacobians into caller-provided results. The Jacobians by the velocities
+   * are the velocity transformations. The Jacobians by the positions are the
+   * transformations to velocity-induced accelerations, since both
+   * differentiate the velocity transformations along the Frenet velocities.
+   *
+   * @param velFrenet query velocities in Frenet coordinates.
+   * @param posFrenet positions corresponding to velocities in Frenet
+   * coordinates.
+   * @param result velocities in Cartesian coordinates.
+   * @param jacobians Jacobians with the velocity blocks determined.
+   * @param workspace scratch arrays reused between calls.
+   */
+  void velCartes(const PointsQueries &velFrenet, const PointsQueries &posFrenet,
+                 PointsQueries &result, JacobiansQueries &jacobians,
+                 Workspace &workspace) const {
+    m_path->frames(posFrenet.x(),
+                   FrameTangents | FrameCurvatures | FrameCurvatureRates,
+                   workspace.m_frames);
+    velTransform(workspace.m_frames, posFrenet, jacobians.velByVel);
+    evaluate(jacobians.velByVel.apply(velFrenet), result);
+    accTransform(workspace.m_frames, velFrenet, posFrenet, jacobians.velByPos);
+  }
+
+  /**
+   * @brief Bind the Frenet frames and transformation matrices to Frenet
+   * positions once, such that velocities and accelerations at these
+   * positions are transformed without evaluating the path again.
+   *
+   * @param posFrenet positions in Frenet coordinates.
+   * @return FrameSetQueries frames bound to the positions.
+   */
+  FrameSetQueries frameSet(const PointsQueries &posFrenet) const {
+    FrameSetQueries result{};
+    frameSet(posFrenet, result);
+    return result;
+  }
+
+  /**
+   * @brief Bind the Frenet frames and transformation matrices to Frenet
+   * positions into a caller-provided FrameSet. Does not allocate if the
+   * FrameSet was bound to the same number of positions before and the path
+   * evaluates without allocation.
+   *
+   * @param posFrenet positions in Frenet coordinates.
+   * @param result frames bound to the positions.
+   */
+  void frameSet(const PointsQueries &posFrenet, FrameSetQueries &result) const {
+    auto &frames{result.m_frames};
+    m_path->frames(posFrenet.x(),
+                   FrameTangents | FrameCurvatures | FrameCurvatureRates,
+                   frames);
+    result.m_posFrenet = posFrenet;
+    velTransform(frames, posFrenet, result.m_velTransforms);
+    result.m_velTransforms.inverse(result.m_velTransformsInv);
+
+    // terms of the velocity-induced accelerations depending on positions
+    const auto &curvs{frames.curvatures};
+    result.m_normalScales = curvs * (1 - curvs * posFrenet.y());
+    result.m_tangentScales = frames.curvatureRates * posFrenet.y();
+  }
+
+  /**
+   * @brief Transform a single Cartesian position to a Frenet position.
+   *
+   * @param posCartes query point in Cartesian coordinates.
+   * @return Point result point in Frenet coordinates.
+   */
+  Point posFrenet(const Point &posCartes) const {
+    return posFrenetAt(posCartes, m_path->length(posCartes));
+  }
+
+  /**
+   * @brief Transform a single Cartesian position to a Frenet position close to
+   * a previous length.
+   *
+   * @param posCartes query point in Cartesian coordinates.
+   * @param hint previous length along the path.
+   * @param window maximum length difference to the hint searched locally.
+   * @return Point result point in Frenet coordinates.
+   */
+  Point posFrenet(const Point &posCartes, Scalar hint, Scalar window) const {
+    return posFrenetAt(posCartes, m_path->length(posCartes, hint, window));
+  }
+
+  /**
+   * @brief Transform a single Frenet position to a Cartesian position.
+   *
+   * @param posFrenet query point in Frenet coordinates.
+   * @return Point result point in Cartesian coordinates.
+   */
+  Point posCartes(const Point &posFrenet) const {
+    const Frame<Scalar> frame{
+        m_path->frame(posFrenet.x(), FramePoints | FrameTangents)};
+    return {frame.point.x() + frame.normal.x() * posFrenet.y(),
+            frame.point.y() + frame.normal.y() * posFrenet.y()};
+  }
+
+  /**
+   * @brief Transform a single Cartesian velocity to a Frenet velocity.
+   *
+   * @param velCartes query velocity in Cartesian coordinates.
+   * @param posFrenet position corresponding to the velocity in Frenet
+   * coordinates.
+   * @return Point result velocity in Frenet coordinates.
+   */
+  Point velFrenet(const Point &velCartes, const Point &posFrenet) const {
+    const Frame<Scalar> frame{
+        m_path->frame(posFrenet.x(), FrameTangents | FrameCurvatures)};
+    return solveVelTransform(frame, posFrenet, velCartes);
+  }
+
+  /**
+   * @brief Transform a single Frenet velocity to a Cartesian velocity.
+   *
+   * @param velFrenet query velocity in Frenet coordinates.
+   * @param posFrenet position corresponding to the velocity in Frenet
+   * coordinates.
+   * @return Point result velocity in Cartesian coordinates.
+   */
+  Point velCartes(const Point &velFrenet, const Point &posFrenet) const {
+    const Frame<Scalar> frame{
+        m_path->frame(posFrenet.x(), FrameTangents | FrameCurvatures)};
+    return applyVelTransform(frame, posFrenet, velFrenet);
+  }
+
+  /**
+   * @brief Transform a single Cartesian acceleration to a Frenet acceleration.
+   *
+   * @param accCartes query acceleration in Cartesian coordinates.
+   * @param velFrenet velocity corresponding to the acceleration in Frenet
+   * coordinates.
+   * @param posFrenet position corresponding to the acceleration in Frenet
+   * coordinates.
+   * @return Point result acceleration in Frenet coordinates.
+   */
+  Point accFrenet(const Point &accCartes, const Point &velFrenet,
+                  const Point &posFrenet) const {
+    const Frame<Scalar> frame{m_path->frame(
+        posFrenet.x(), FrameTangents | FrameCurvatures | FrameCurvatureRates)};
+    return solveVelTransform(
+        frame, posFrenet,
+        accCartes - applyAccTransform(frame, velFrenet, posFrenet));
+  }
+
+  /**
+   * @brief Transform a single Frenet acceleration to a Cartesian acceleration.
+   *
+   * @param accFrenet query acceleration in Frenet coordinates.
+   * @param velFrenet velocity corresponding to the acceleration in Frenet
+   * coordinates.
+   * @param posFrenet position corresponding to the acceleration in Frenet
+   * coordinates.
+   * @return Point result acceleration in Cartesian coordinates.
+   */
+  Point accCartes(const Point &accFrenet, const Point &velFrenet,
+                  const Point &posFrenet) const {
+    const Frame<Scalar> frame{m_path->frame(
+        posFrenet.x(), FrameTangents | FrameCurvatures | FrameCurvatureRates)};
+    return applyVelTransform(frame, posFrenet, accFrenet) +
+           applyAccTransform(frame, velFrenet, posFrenet);
+  }
+
+  /**
+   * @brief Transform a single Cartesian state to a Frenet state. Evaluates the
+   * path once for position, velocity and acceleration.
+   *
+   * @param posCartes query position in Cartesian coordinates.
+   * @param velCartes query velocity in Cartesian coordinates.
+   * @param accCartes query acceleration in Cartesian coordinates.
+   * @return State<Scalar> result state in Frenet coordinates.
+   */
+  State<Scalar> stateFrenet(const Point &posCartes, const Point &velCartes,
+                            const Point &accCartes) const {
+    return stateFrenetAt(posCartes, velCartes, accCartes,
+                         m_path->length(posCartes));
+  }
+
+  /**
+   * @brief Transform a single Cartesian state to a Frenet state close to a
+   * previous length.
+   *
+   * @param posCartes query position in Cartesian coordinates.
+   * @param velCartes query velocity in Cartesian coordinates.
+   * @param accCartes query acceleration in Cartesian coordinates.
+   * @param hint previous length along the path.
+   * @param window maximum length difference to the hint searched locally.
+   * @return State<Scalar> result state in Frenet coordinates.
+   */
+  State<Scalar> stateFrenet(const Point &posCartes, const Point &velCartes,
+                            const Point &accCartes, Scalar hint,
+                            Scalar window) const {
+    return stateFrenetAt(posCartes, velCartes, accCartes,
+                         m_path->length(posCartes, hint, window));
+  }
+
+  /**
+   * @brief Transform a single Frenet state to a Cartesian state. Evaluates the
+   * path once for position, velocity and acceleration.
+   *
+   * @param posFrenet query position in Frenet coordinates.
+   * @param velFrenet query velocity in Frenet coordinates.
+   * @param accFrenet query acceleration in Frenet coordinates.
+   * @return State<Scalar> result state in Cartesian coordinates.
+   */
+  State<Scalar> stateCartes(const Point &posFrenet, const Point &velFrenet,
+                            const Point &accFrenet) const {
+    const Frame<Scalar> frame{m_path->frame(posFrenet.x(), FrameAll)};
+    return {{frame.point.x() + frame.normal.x() * posFrenet.y(),
+             frame.point.y() + frame.normal.y() * posFrenet.y()},
+            applyVelTransform(frame, posFrenet, velFrenet),
+            applyVelTransform(frame, posFrenet, accFrenet) +
+                applyAccTransform(frame, velFrenet, posFrenet)};
   }
 
 protected:
-  std::shared_ptr<Path<NumQueries>> m_path; /**< Store path. */
+  std::shared_ptr<PathType> m_path; /**< Store path. */
 
 private:
+  /**
+   * @brief Transform Cartesian positions to Frenet positions at the lengths
+   * of their projections onto the path stored in "workspace".
+   *
+   * @param posCartes query points in Cartesian coordinates.
+   * @param result points in Frenet coordinates.
+   * @param workspace scratch arrays with the lengths of the projections.
+   */
+  void posFrenetAt(const PointsQueries &posCartes, PointsQueries &result,
+                   Workspace &workspace) const {
+    // next points on path to Cartesian positions and normal vectors on path
+    auto &frames{workspace.m_frames};
+    m_path->frames(workspace.m_lengths, FramePoints | FrameTangents, frames);
+    // scalar products of normals and vectors from path points to query points
+    result.y() = frames.normals.x() * (posCartes.x() - frames.points.x()) +
+                 frames.normals.y() * (posCartes.y() - frames.points.y());
+    result.x() = workspace.m_lengths;
+  }
+
+  /**
+   * @brief Transform a single Cartesian position to a Frenet position at the
+   * length of its projection onto the path.
+   *
+   * @param posCartes query point in Cartesian coordinates.
+   * @param length length of the projection along the path.
+   * @return Point result point in Frenet coordinates.
+   */
+  Point posFrenetAt(const Point &posCartes, Scalar length) const {
+    const Frame<Scalar> frame{
+        m_path->frame(length, FramePoints | FrameTangents)};
+    return {length,
+            frame.normal.x() * (posCartes.x() - frame.point.x()) +
+                frame.normal.y() * (posCartes.y() - frame.point.y())};
+  }
+
+  /**
+   * @brief Transform a single Cartesian state to a Frenet state at the length
+   * of its projection onto the path.
+   *
+   * @param posCartes query position in Cartesian coordinates.
+   * @param velCartes query velocity in Cartesian coordinates.
+   * @param accCartes query acceleration in Cartesian coordinates.
+   * @param length length of the projection along the path.
+   * @return State<Scalar> result state in Frenet coordinates.
+   */
+  State<Scalar> stateFrenetAt(const Point &posCartes, const Point &velCartes,
+                              const Point &accCartes, Scalar length) const {
+    const Frame<Scalar> frame{m_path->frame(length, FrameAll)};
+    const Point pos{length,
+                    frame.normal.x() * (posCartes.x() - frame.point.x()) +
+                        frame.normal.y() * (posCartes.y() - frame.point.y())};
+    const Point vel{solveVelTransform(frame, pos, velCartes)};
+    return {pos, vel,
+            solveVelTransform(frame, pos,
+                              accCartes - applyAccTransform(frame, vel, pos))};
+  }
+
+  /**
+   * @brief Transform Cartesian states to Frenet states at the lengths of their
+   * projections onto the path stored in "workspace".
+   *
+   * @param posCartes query positions in Cartesian coordinates.
+   * @param velCartes query velocities in Cartesian coordinates.
+   * @param accCartes query accelerations in Cartesian coordinates.
+   * @param result states in Frenet coordinates.
+   * @param workspace scratch arrays with the lengths of the projections.
+   */
+  void stateFrenetAt(const PointsQueries &posCartes,
+                     const PointsQueries &velCartes,
+                     const PointsQueries &accCartes, StatesQueries &result,
+                     Workspace &workspace) const {
+    // all path properties at the projections
+    auto &frames{workspace.m_frames};
+    m_path->frames(workspace.m_lengths, FrameAll, frames);
+    result.pos.x() = workspace.m_lengths;
+    result.pos.y() =
+        frames.normals.x() * (posCartes.x() - frames.points.x()) +
+        frames.normals.y() * (posCartes.y() - frames.points.y());
+
+    // transformation matrices from Cartesian to Frenet frames
+    velTransform(frames, result.pos, workspace.m_velTransforms);
+    workspace.m_velTransforms.inverseApply(velCartes, result.vel);
+    accFrenetAt(accCartes, result.vel, result.pos, result.acc, workspace);
+  }
+
+  /**
+   * @brief Transform Cartesian accelerations to Frenet accelerations with the
+   * frames and velocity transformations stored in "workspace".
+   *
+   * @param accCartes query accelerations in Cartesian coordinates.
+   * @param velFrenet velocities corresponding to accelerations in Frenet
+   * coordinates.
+   * @param posFrenet positions corresponding to accelerations in Frenet
+   * coordinates.
+   * @param result accelerations in Frenet coordinates.
+   * @param workspace scratch arrays with frames and transformations.
+   */
+  static void accFrenetAt(const PointsQueries &accCartes,
+                          const PointsQueries &velFrenet,
+                          const PointsQueries &posFrenet, PointsQueries &result,
+                          Workspace &workspace) {
+    // transformation matrices to determine Cartesian acceleration induced by
+    // Frenet velocities
+    accTransform(workspace.m_frames, velFrenet, posFrenet,
+                 workspace.m_accTransforms);
+    // solve the velocity transformations for the differences between query
+    // accelerations and velocity-induced accelerations in a single pass
+    workspace.m_velTransforms.inverseApply(
+        accCartes - workspace.m_accTransforms.apply(velFrenet), result);
+  }
+
+  /**
+   * @brief Transform Frenet accelerations to Cartesian accelerations with the
+   * frames and velocity transformations stored in "workspace".
+   *
+   * @param accFrenet query accelerations in Frenet coordinates.
+   * @param velFrenet velocities corresponding to accelerations in Frenet
+   * coordinates.
+   * @param posFrenet positions corresponding to accelerations in Frenet
+   * coordinates.
+   * @param result accelerations in Cartesian coordinates.
+   * @param workspace scratch arrays with frames and transformations.
+   */
+  static void accCartesAt(const PointsQueries &accFrenet,
+                          const PointsQueries &velFrenet,
+                          const PointsQueries &posFrenet, PointsQueries &result,
+                          Workspace &workspace) {
+    // transformation matrices to determine Cartesian acceleration induced by
+    // Frenet velocities
+    accTransform(workspace.m_frames, velFrenet, posFrenet,
+                 workspace.m_accTransforms);
+    // sum of velocity-induced accelerations and transformed Frenet
+    // accelerations
+    evaluate(workspace.m_velTransforms.apply(accFrenet) +
+                 workspace.m_accTransforms.apply(velFrenet),
+             result);
+  }
+
+  /**
+   * @brief Evaluate a point sequence into the existing storage of "result".
+   * Both coordinates are evaluated in turn, such that "points" must not
+   * depend on "result".
+   *
+   * @tparam Derived type of the point sequence.
+   * @param points point sequence to evaluate.
+   * @param result evaluated points.
+   */
+  template <typename Derived>
+  static void evaluate(const PointsBase<Derived, BasicPoint<Scalar>> &points,
+                       PointsQueries &result) {
+    result.x() = points.derived().x();
+    result.y() = points.derived().y();
+  }
+
   /**
    * @brief Transformation matrices from Frenet to Cartesian frame.
    *
+   * @param frames tangents, normals and curvatures at "posFrenet".
    * @param posFrenet query positions in Frenet frame.
-   * @return Eigen::Array<ArrayQueries, 2, 2> matrices at "posFrenet".
+   * @param result matrices at "posFrenet".
    */
-  Eigen::Array<ArrayQueries, 2, 2>
-  velTransform(const Points<NumQueries> &posFrenet) const {
-    const auto tangents{m_path->tangent(posFrenet.x())};
-    const auto normals{m_path->normal(posFrenet.x())};
-    const auto curvs{m_path->angle1(posFrenet.x())};
-    return {{tangents.x() * (1 - curvs * posFrenet.y()), normals.x()},
-            {tangents.y() * (1 - curvs * posFrenet.y()), normals.y()}};
+  static void velTransform(const Frames<NumQueries, Scalar> &frames,
+                           const PointsQueries &posFrenet,
+                           Internal::Matrices2<NumQueries, Scalar> &result) {
+    const auto &tangents{frames.tangents};
+    const auto &normals{frames.normals};
+    const auto &curvs{frames.curvatures};
+    result.resize(curvs.rows());
+    result(0, 0) = tangents.x() * (1 - curvs * posFrenet.y());
+    result(0, 1) = normals.x();
+    result(1, 0) = tangents.y() * (1 - curvs * posFrenet.y());
+    result(1, 1) = normals.y();
   }
 
   /**
    * @brief Transformation matrices from Frenet velocities to Cartesian
    * velocity-induced accelerations.
    *
+   * @param frames tangents, normals, curvatures and curvature derivatives at
+   * "posFrenet".
    * @param velFrenet velocities in Frenet frame.
    * @param posFrenet positions in Frenet frame.
-   * @return Eigen::Array<ArrayQueries, 2, 2> transformations at "velFrenet" and
-   * "posFrenet".
+   * @param result transformations at "velFrenet" and "posFrenet".
    */
-  Eigen::Array<ArrayQueries, 2, 2>
-  accTransform(const Points<NumQueries> &velFrenet,
-               const Points<NumQueries> &posFrenet) const {
-    const auto tangents{m_path->tangent(posFrenet.x())};
-    const auto normals{m_path->normal(posFrenet.x())};
+  static void accTransform(const Frames<NumQueries, Scalar> &frames,
+                           const PointsQueries &velFrenet,
+                           const PointsQueries &posFrenet,
+                           Internal::Matrices2<NumQueries, Scalar> &result) {
+    const auto &tangents{frames.tangents};
+    const auto &normals{frames.normals};
     // scaling factor due to lateral position from path and path curvature
-    const auto curvs{m_path->angle1(posFrenet.x())};
+    const auto &curvs{frames.curvatures};
     const auto latScale{1 - curvs * posFrenet.y()};
     // scaling factor derivatvie
-    const auto curv1s{m_path->angle2(posFrenet.x())};
+    const auto &curv1s{frames.curvatureRates};
     const auto latScaleDer{curv1s * velFrenet.x() * posFrenet.y() +
                            curvs * velFrenet.y()};
-    return {{normals.x() * curvs * latScale * velFrenet.x() -
-                 tangents.x() * latScaleDer,
-             -curvs * tangents.x() * velFrenet.x()},
-            {normals.y() * curvs * latScale * velFrenet.x() -
-                 tangents.y() * latScaleDer,
-             -curvs * tangents.y() * velFrenet.x()}};
+    result.resize(curvs.rows());
+    result(0, 0) = normals.x() * curvs * latScale * velFrenet.x() -
+                   tangents.x() * latScaleDer;
+    result(0, 1) = -curvs * tangents.x() * velFrenet.x();
+    result(1, 0) = normals.y() * curvs * latScale * velFrenet.x() -
+                   tangents.y() * latScaleDer;
+    result(1, 1) = -curvs * tangents.y() * velFrenet.x();
+  }
+
+  /**
+   * @brief Apply the transformation from Frenet to Cartesian frame at a single
+   * position to a vector.
+   *
+   * @param frame tangent, normal and curvature at "posFrenet".
+   * @param posFrenet query position in Frenet frame.
+   * @param vector in Frenet frame.
+   * @return Point vector in Cartesian frame.
+   */
+  static Point applyVelTransform(const Frame<Scalar> &frame,
+                                 const Point &posFrenet, const Point &vector) {
+    const Scalar latScale{1 - frame.curvature * posFrenet.y()};
+    return {frame.tangent.x() * latScale * vector.x() +
+                frame.normal.x() * vector.y(),
+            frame.tangent.y() * latScale * vector.x() +
+                frame.normal.y() * vector.y()};
+  }
+
+  /**
+   * @brief Solve the transformation from Frenet to Cartesian frame at a single
+   * position for a vector by Cramer's rule.
+   *
+   * @param frame tangent, normal and curvature at "posFrenet".
+   * @param posFrenet query position in Frenet frame.
+   * @param vector in Cartesian frame.
+   * @return Point vector in Frenet frame.
+   */
+  static Point solveVelTransform(const Frame<Scalar> &frame,
+                                 const Point &posFrenet, const Point &vector) {
+    const Scalar latScale{1 - frame.curvature * posFrenet.y()};
+    const Scalar coeff00{frame.tangent.x() * latScale};
+    const Scalar coeff10{frame.tangent.y() * latScale};
+    const Scalar coeff01{frame.normal.x()};
+    const Scalar coeff11{frame.normal.y()};
+    const Scalar determinant{coeff00 * coeff11 - coeff10 * coeff01};
+    return {(coeff11 * vector.x() - coeff01 * vector.y()) / determinant,
+            (coeff00 * vector.y() - coeff10 * vector.x()) / determinant};
+  }
+
+  /**
+   * @brief Cartesian acceleration induced by a Frenet velocity at a single
+   * position.
+   *
+   * @param frame tangent, normal, curvature and curvature derivative at
+   * "posFrenet".
+   * @param velFrenet velocity in Frenet frame.
+   * @param posFrenet position in Frenet frame.
+   * @return Point induced acceleration in Cartesian frame.
+   */
+  static Point applyAccTransform(const Frame<Scalar> &frame,
+                                 const Point &velFrenet,
+                                 const Point &posFrenet) {
+    const Scalar curv{frame.curvature};
+    const Scalar latScale{1 - curv * posFrenet.y()};
+    const Scalar latScaleDer{frame.curvatureRate * velFrenet.x() *
+                                 posFrenet.y() +
+                             curv * velFrenet.y()};
+    const Scalar coeff00{frame.normal.x() * curv * latScale * velFrenet.x() -
+                         frame.tangent.x() * latScaleDer};
+    const Scalar coeff01{-curv * frame.tangent.x() * velFrenet.x()};
+    const Scalar coeff10{frame.normal.y() * curv * latScale * velFrenet.x() -
+                         frame.tangent.y() * latScaleDer};
+    const Scalar coeff11{-curv * frame.tangent.y() * velFrenet.x()};
+    return {coeff00 * velFrenet.x() + coeff01 * velFrenet.y(),
+            coeff10 * velFrenet.x() + coeff11 * velFrenet.y()};
   }
 };
 }; // namespace FrenetTransform
 
-#endif
\ No newline at end of file
+#endif
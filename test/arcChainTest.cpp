@@ -0,0 +1,93 @@
+#include "frenetTransform/arcChain.h"
+#include "frenetTransform/internal/constexprTypes.h"
+#include "frenetTransform/test/pathCircleApproxTest.h"
+
+#include <Eigen/Core>
+#include <gtest/gtest.h>
+#include <math.h>
+
+namespace FrenetTransform {
+namespace Internal {
+/**
+ * @brief Arc chain of the circle as arcs of a quarter turn.
+ *
+ * @tparam NumQueries number of query points.
+ */
+template <typename NumQueries> struct ArcChainCircle {
+  using Queries = NumQueries;
+  using PathType = ArcChain<NumQueries::s_val>;
+
+  static constexpr CircleTolerances s_tolerances{.points = 1e-12,
+                                                 .tangents = 1e-12,
+                                                 .angles1 = 1e-12,
+                                                 .angles2 = 1e-12,
+                                                 .curvatureRates = 1e-14,
+                                                 .lengths = 1e-12,
+                                                 .posFrenet = 1e-12,
+                                                 .velFrenet = 1e-10,
+                                                 .accFrenet = 1e-9,
+                                                 .accCartes = 1e-9};
+
+  static PathType approximate(double radius) {
+    return PathType{Point{-radius, 0.0}, -M_PI / 2,
+                    Eigen::ArrayXd::LinSpaced(5, 0.0, 2 * M_PI * radius),
+                    Eigen::ArrayXd::Constant(4, 1 / radius)};
+  }
+};
+
+using ArcChainCircles = testing::Types<ArcChainCircle<Integral<Eigen::Dynamic>>,
+                                       ArcChainCircle<Integral<100>>>;
+INSTANTIATE_TYPED_TEST_SUITE_P(ArcChain, PathCircleApproxTest, ArcChainCircles);
+
+template <typename NumQueries> class ArcChainTest : public TestBase {};
+
+using Queries = testing::Types<Integral<Eigen::Dynamic>, Integral<100>>;
+TYPED_TEST_SUITE(ArcChainTest, Queries);
+
+TYPED_TEST(ArcChainTest, StadiumTrack) {
+  // straights joined by half circles, counter-clockwise from the origin
+  const double radius{5.0};
+  const ArcChain<TypeParam::s_val> track{
+      Point{0.0, 0.0}, 0.0,
+      Eigen::Array<double, 5, 1>{0.0, 10.0, 10.0 + M_PI * radius,
+                                 20.0 + M_PI * radius,
+                                 20.0 + 2 * M_PI * radius},
+      Eigen::Array4d{0.0, 1 / radius, 0.0, 1 / radius}};
+
+  // track closes at the origin with the start heading
+  const Frame<double> end{track.frame(20.0 + 2 * M_PI * radius)};
+  EXPECT_NEAR(end.point.x(), 0.0, 1e-12);
+  EXPECT_NEAR(end.point.y(), 0.0, 1e-12);
+  EXPECT_NEAR(end.tangent.x(), 1.0, 1e-12);
+  EXPECT_NEAR(end.tangent.y(), 0.0, 1e-12);
+
+  EXPECT_NEAR(track.length(Point{5.0, -2.0}), 5.0, 1e-12);
+  EXPECT_NEAR(track.length(Point{12.0, 3.0}), 10.0 + M_PI / 4 * radius,
+              1e-12);
+  EXPECT_NEAR(track.length(Point{5.0, 12.0}), 15.0 + M_PI * radius, 1e-12);
+  EXPECT_NEAR(track.length(Point{-2.0, 5.0}), 20.0 + 3 * M_PI / 2 * radius,
+              1e-12);
+  EXPECT_DOUBLE_EQ(track.frame(12.0).curvature, 1 / radius);
+  EXPECT_DOUBLE_EQ(track.frame(30.0).curvature, 0.0);
+}
+
+TYPED_TEST(ArcChainTest, ReverseCurve) {
+  // half circles of radius two turning left and then right
+  const ArcChain<TypeParam::s_val> curve{
+      Point{0.0, 0.0}, 0.0, Eigen::Array3d{0.0, 2 * M_PI, 4 * M_PI},
+      Eigen::Array2d{0.5, -0.5}};
+
+  const Frame<double> end{curve.frame(4 * M_PI)};
+  EXPECT_NEAR(end.point.x(), 0.0, 1e-12);
+  EXPECT_NEAR(end.point.y(), 8.0, 1e-12);
+  EXPECT_NEAR(end.tangent.x(), 1.0, 1e-12);
+  EXPECT_NEAR(end.tangent.y(), 0.0, 1e-12);
+  EXPECT_DOUBLE_EQ(end.curvature, -0.5);
+
+  EXPECT_NEAR(curve.length(Point{3.0, 2.0}), M_PI, 1e-12);
+  EXPECT_NEAR(curve.length(Point{-3.0, 6.0}), 3 * M_PI, 1e-12);
+  // beyond the end of the half circle resolves to the end
+  EXPECT_NEAR(curve.length(Point{3.0, 8.0}), 4 * M_PI, 1e-12);
+}
+}; // namespace Internal
+}; // namespace FrenetTransform
@@ -0,0 +1,92 @@
+#include "frenetTransform/clothoidSpline.h"
+#include "frenetTransform/internal/constexprTypes.h"
+#include "frenetTransform/test/pathCircleApproxTest.h"
+
+#include <Eigen/Core>
+#include <gtest/gtest.h>
+#include <math.h>
+
+namespace FrenetTransform {
+namespace Internal {
+/**
+ * @brief Clothoid spline of segments with the constant curvature of the
+ * circle.
+ *
+ * @tparam NumQueries number of query points.
+ */
+template <typename NumQueries> struct ClothoidSplineCircle {
+  using Queries = NumQueries;
+  using PathType = ClothoidSpline<NumQueries::s_val>;
+
+  // exact curvature rates keep acceleration errors at rounding level
+  static constexpr CircleTolerances s_tolerances{.points = 1e-12,
+                                                 .tangents = 1e-12,
+                                                 .angles1 = 1e-12,
+                                                 .angles2 = 1e-12,
+                                                 .curvatureRates = 1e-14,
+                                                 .lengths = 1e-10,
+                                                 .posFrenet = 1e-10,
+                                                 .velFrenet = 1e-10,
+                                                 .accFrenet = 1e-9,
+                                                 .accCartes = 1e-9};
+
+  static PathType approximate(double radius) {
+    return PathType{Point{-radius, 0.0}, -M_PI / 2,
+                    Eigen::ArrayXd::LinSpaced(5, 0.0, 2 * M_PI * radius),
+                    Eigen::ArrayXd::Constant(5, 1 / radius)};
+  }
+};
+
+using ClothoidSplineCircles =
+    testing::Types<ClothoidSplineCircle<Integral<Eigen::Dynamic>>,
+                   ClothoidSplineCircle<Integral<100>>>;
+INSTANTIATE_TYPED_TEST_SUITE_P(ClothoidSpline, PathCircleApproxTest,
+                               ClothoidSplineCircles);
+
+template <typename NumQueries> class ClothoidSplineTest : public TestBase {};
+
+using Queries = testing::Types<Integral<Eigen::Dynamic>, Integral<100>>;
+TYPED_TEST_SUITE(ClothoidSplineTest, Queries);
+
+TYPED_TEST(ClothoidSplineTest, FresnelClothoid) {
+  // clothoid through the origin with Fresnel integrals as coordinates
+  const ClothoidSpline<TypeParam::s_val> clothoid{
+      Point{0.0, 0.0}, 0.0, Eigen::Array2d{0.0, 2.0},
+      Eigen::Array2d{0.0, 2 * M_PI}};
+
+  const Frame<double> frame{clothoid.frame(1.0)};
+  EXPECT_NEAR(frame.point.x(), 0.7798934003768228, 1e-14);
+  EXPECT_NEAR(frame.point.y(), 0.4382591473903548, 1e-14);
+  EXPECT_NEAR(frame.tangent.x(), 0.0, 1e-14);
+  EXPECT_NEAR(frame.tangent.y(), 1.0, 1e-14);
+  EXPECT_DOUBLE_EQ(frame.curvature, M_PI);
+  EXPECT_DOUBLE_EQ(frame.curvatureRate, M_PI);
+}
+
+TYPED_TEST(ClothoidSplineTest, SegmentsClothoid) {
+  // line, clothoid and arc of a road with continuous curvature
+  const ClothoidSpline<Eigen::Dynamic> road{
+      Point{1.0, 2.0}, 0.3, Eigen::Array4d{0.0, 10.0, 30.0, 40.0},
+      Eigen::Array4d{0.0, 0.0, 0.1, 0.1}};
+  const Eigen::ArrayXd lengths{Eigen::ArrayXd::LinSpaced(41, 0.0, 40.0)};
+  const auto frames{road.frames(lengths)};
+
+  for (int index{}; index < lengths.rows(); ++index) {
+    const double length{lengths(index)};
+    const double curvature{std::clamp((length - 10.0) / 200.0, 0.0, 0.1)};
+    EXPECT_NEAR(frames.curvatures(index), curvature, 1e-15);
+    // boundaries resolve to the segment ending at them
+    const double curvatureRate{length > 10.0 && length <= 30.0 ? 5e-3 : 0.0};
+    EXPECT_NEAR(frames.curvatureRates(index), curvatureRate, 1e-15);
+  }
+
+  // straight line before the clothoid
+  EXPECT_NEAR(frames.points.x(10), 1.0 + 10.0 * std::cos(0.3), 1e-12);
+  EXPECT_NEAR(frames.points.y(10), 2.0 + 10.0 * std::sin(0.3), 1e-12);
+  // heading after the clothoid and along the arc
+  const double heading{0.3 + 20.0 * 0.1 / 2 + 10.0 * 0.1};
+  EXPECT_NEAR(frames.tangents.x(40), std::cos(heading), 1e-12);
+  EXPECT_NEAR(frames.tangents.y(40), std::sin(heading), 1e-12);
+}
+}; // namespace Internal
+}; // namespace FrenetTransform
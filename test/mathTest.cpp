@@ -120,6 +120,22 @@ TEST(partialLength, StraightLine) {
     EXPECT_NEAR(result(row), groundTruth(row), 1e-10);
 }
 
+/**
+ * @brief Test partial length with diagonal line in single precision.
+ *
+ */
+TEST(partialLength, DiagonalLineFloat) {
+  Eigen::Array<float, 4, 1> x{0.0f, 3.0f, 6.0f, 9.0f};  // input in x-direction
+  Eigen::Array<float, 4, 1> y{0.0f, 4.0f, 8.0f, 12.0f}; // input in y-direction
+
+  Eigen::Array<float, 4, 1> result{
+      FrenetTransform::partialLength(x, y)}; // partial length result
+
+  // test for equality between ground truth and result
+  for (int row{}; row < result.rows(); ++row)
+    EXPECT_FLOAT_EQ(result(row), 5.0f * row);
+}
+
 /**
  * @brief Test correct index from increasing sequence with positive elements.
  *
@@ -149,5 +165,89 @@ TEST(first, IncreasingSequenceNegative) {
 
   EXPECT_EQ(result, groundTruth);
 }
+
+/**
+ * @brief Test index of first element not less than a value in ascending
+ * sequence.
+ *
+ */
+TEST(firstSorted, IncreasingSequenceValue) {
+  Eigen::Array<double, 6, 1> input{-3, -1, 3, 3, 5, 6}; // ascending sequence
+
+  // compare with linear search for values between and at the elements
+  for (double value : {-4.0, -3.0, -2.0, 0.0, 3.0, 4.0, 6.0})
+    EXPECT_EQ(FrenetTransform::firstSorted(input, value),
+              FrenetTransform::first(input - value));
+}
+
+/**
+ * @brief Test indices of ascending values resolved from the previous index.
+ *
+ */
+TEST(firstSorted, IncreasingSequenceWalk) {
+  Eigen::Array<double, 8, 1> input{-3, -1, 0, 2, 3, 3, 5, 6}; // ascending
+
+  // resolve ascending values starting at the index of the previous value
+  int index{};
+  for (double value : {-4.0, -1.0, 2.5, 3.0, 5.5, 6.0, 7.0}) {
+    index = FrenetTransform::firstSorted(input, value, index);
+    EXPECT_EQ(index, FrenetTransform::first(input - value));
+  }
+}
+
+/**
+ * @brief Test last index for value exceeding all elements.
+ *
+ */
+TEST(firstSorted, IncreasingSequenceExceeded) {
+  Eigen::Array<double, 5, 1> input{-3, -1, 3, 5, 6}; // ascending sequence
+
+  int result{FrenetTransform::firstSorted(input, 7.0)}; // get last index
+
+  int groundTruth{4}; // ground truth index
+
+  EXPECT_EQ(result, groundTruth);
+}
+
+/**
+ * @brief Test Fresnel integrals C(1) and S(1) of a clothoid split into arcs.
+ *
+ */
+TEST(fresnel, Clothoid) {
+  constexpr int numArcs{16}; // arcs turning by less than a quarter radian
+  constexpr double length{1.0 / numArcs}; // arc length
+  std::array<double, 2> result{};         // displacements of all arcs
+  for (int arc{}; arc < numArcs; ++arc) {
+    const double start{arc * length}; // length at the arc start
+    const std::array<double, 2> displacement{FrenetTransform::fresnel(
+        M_PI / 2 * start * start, M_PI * start, M_PI, length)};
+    result[0] += displacement[0];
+    result[1] += displacement[1];
+  }
+
+  EXPECT_NEAR(result[0], 0.7798934003768228, 1e-14);
+  EXPECT_NEAR(result[1], 0.4382591473903548, 1e-14);
+}
+
+/**
+ * @brief Test Fresnel integrals C(1) and S(1) in single precision.
+ *
+ */
+TEST(fresnel, ClothoidFloat) {
+  constexpr int numArcs{16}; // arcs turning by less than a quarter radian
+  constexpr float length{1.0f / numArcs}; // arc length
+  constexpr float pi{static_cast<float>(M_PI)};
+  std::array<float, 2> result{}; // displacements of all arcs
+  for (int arc{}; arc < numArcs; ++arc) {
+    const float start{arc * length}; // length at the arc start
+    const std::array<float, 2> displacement{FrenetTransform::fresnel(
+        pi / 2 * start * start, pi * start, pi, length)};
+    result[0] += displacement[0];
+    result[1] += displacement[1];
+  }
+
+  EXPECT_NEAR(result[0], 0.7798934003768228, 1e-6);
+  EXPECT_NEAR(result[1], 0.4382591473903548, 1e-6);
+}
 }; // namespace Internal
-}; // namespace FrenetTransform
\ No newline at end of file
+}; // namespace FrenetTransform
@@ -0,0 +1,94 @@
+#include "frenetTransform/internal/matrices2.h"
+#include "frenetTransform/points.h"
+
+#include <Eigen/Core>
+#include <gtest/gtest.h>
+
+namespace FrenetTransform {
+namespace Internal {
+/**
+ * @brief Batch of three 2x2 matrices with vectors.
+ *
+ */
+class Matrices2Test : public testing::Test {
+protected:
+  using Array3 = Eigen::Array<double, 3, 1>;
+
+  Matrices2<3> m_matrices{3};
+  const Points<3> m_vectors{Array3{1, -2, 0.5}, Array3{3, 4, -1}};
+
+  void SetUp() override {
+    m_matrices(0, 0) = Array3{1, 2, 0};
+    m_matrices(0, 1) = Array3{2, 0, 1};
+    m_matrices(1, 0) = Array3{3, 1, -1};
+    m_matrices(1, 1) = Array3{4, 1, 0};
+  }
+};
+
+TEST_F(Matrices2Test, Determinants) {
+  const Array3 determinants{m_matrices.determinants()};
+
+  const Array3 groundTruth{-2, 2, 1};
+  for (int index{}; index < 3; ++index)
+    EXPECT_EQ(determinants(index), groundTruth(index));
+}
+
+TEST_F(Matrices2Test, Apply) {
+  const Points<3> result{m_matrices.apply(m_vectors)};
+
+  const Array3 groundTruthX{7, -4, -1};
+  const Array3 groundTruthY{15, 2, -0.5};
+  for (int index{}; index < 3; ++index) {
+    EXPECT_EQ(result.x(index), groundTruthX(index));
+    EXPECT_EQ(result.y(index), groundTruthY(index));
+  }
+}
+
+TEST_F(Matrices2Test, InverseApply) {
+  // solving the systems of applied vectors recovers the vectors
+  const Points<3> applied{m_matrices.apply(m_vectors)};
+  Points<3> result{};
+  m_matrices.inverseApply(applied, result);
+
+  for (int index{}; index < 3; ++index) {
+    EXPECT_NEAR(result.x(index), m_vectors.x(index), 1e-12);
+    EXPECT_NEAR(result.y(index), m_vectors.y(index), 1e-12);
+  }
+}
+
+TEST_F(Matrices2Test, Inverse) {
+  Matrices2<3> inverses{};
+  m_matrices.inverse(inverses);
+  Matrices2<3> products{};
+  m_matrices.multiply(inverses, products);
+
+  // products with the inverses are identities
+  for (int index{}; index < 3; ++index) {
+    EXPECT_NEAR(products(0, 0)(index), 1.0, 1e-12);
+    EXPECT_NEAR(products(0, 1)(index), 0.0, 1e-12);
+    EXPECT_NEAR(products(1, 0)(index), 0.0, 1e-12);
+    EXPECT_NEAR(products(1, 1)(index), 1.0, 1e-12);
+  }
+}
+
+TEST_F(Matrices2Test, Multiply) {
+  Matrices2<3> products{};
+  m_matrices.multiply(m_matrices, products);
+
+  // squares of the first matrix [[1, 2], [3, 4]]
+  EXPECT_EQ(products(0, 0)(0), 7);
+  EXPECT_EQ(products(0, 1)(0), 10);
+  EXPECT_EQ(products(1, 0)(0), 15);
+  EXPECT_EQ(products(1, 1)(0), 22);
+}
+
+TEST_F(Matrices2Test, DynamicResize) {
+  Matrices2<Eigen::Dynamic> matrices{};
+  EXPECT_EQ(matrices.numMatrices(), 0);
+
+  matrices.resize(5);
+  EXPECT_EQ(matrices.numMatrices(), 5);
+  EXPECT_EQ(matrices(1, 0).rows(), 5);
+}
+}; // namespace Internal
+}; // namespace FrenetTransform
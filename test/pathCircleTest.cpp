@@ -1,8 +1,35 @@
 #include "frenetTransform/test/pathCircleTest.h"
 #include "frenetTransform/internal/constexprTypes.h"
+#include "frenetTransform/internal/matrices2.h"
+#include "frenetTransform/transform.h"
 
 namespace FrenetTransform {
 namespace Internal {
+/**
+ * @brief Expect Jacobians close to central differences of "function".
+ *
+ * @tparam Function callable mapping Points<NumQueries> to Points<NumQueries>.
+ * @tparam NumQueries number of query points.
+ * @param function to differentiate.
+ * @param inputs points to differentiate at.
+ * @param jacobians Jacobians of "function" at "inputs".
+ */
+template <typename Function, int NumQueries>
+void expectJacobians(const Function &function,
+                     const Points<NumQueries> &inputs,
+                     const Matrices2<NumQueries> &jacobians) {
+  constexpr double step{1e-6};
+  for (int col{}; col < 2; ++col) {
+    const Point offset{col == 0 ? step : 0.0, col == 1 ? step : 0.0};
+    const Points<NumQueries> diffs{function(inputs + offset) -
+                                   function(inputs - offset)};
+    for (int index{}; index < inputs.numPoints(); ++index) {
+      EXPECT_NEAR(jacobians(0, col)(index), diffs.x(index) / (2 * step), 1e-5);
+      EXPECT_NEAR(jacobians(1, col)(index), diffs.y(index) / (2 * step), 1e-5);
+    }
+  }
+}
+
 // using Queries = testing::Types<Integral<Eigen::Dynamic>, Integral<100>>;
 using Queries = testing::Types<Integral<Eigen::Dynamic>, Integral<100>>;
 TYPED_TEST_SUITE(PathCircleTest, Queries);
@@ -19,6 +46,118 @@ TYPED_TEST(PathCircleTest, DirectionAngle) {
 
   this->expectAllClose(anglesEst, anglesGtr, 1e-2);
 }
+
+TYPED_TEST(PathCircleTest, Frames) {
+  const auto &lengths{this->m_posFrenet.x()};
+  const auto frames{this->m_circle.frames(lengths)};
+
+  // single pass must provide identical properties to separate evaluations
+  this->expectAllClose(frames.points.x(), this->m_circle(lengths).x(),
+                       limits::min());
+  this->expectAllClose(frames.normals.y(), this->m_circle.normal(lengths).y(),
+                       limits::min());
+  this->expectAllClose(frames.curvatures, this->m_circle.angle1(lengths),
+                       limits::min());
+  this->expectAllClose(frames.tangents.x(), this->m_circle.tangent(lengths).x(),
+                       limits::min());
+}
+
+TYPED_TEST(PathCircleTest, SinglePoint) {
+  const auto &lengths{this->m_posFrenet.x()};
+  const auto frames{this->m_circle.frames(lengths)};
+  for (int index{}; index < this->s_numQueries; ++index) {
+    const Frame<double> frame{this->m_circle.frame(lengths(index))};
+    EXPECT_NEAR(frame.point.x(), frames.points.x(index), 1e-12);
+    EXPECT_NEAR(frame.point.y(), frames.points.y(index), 1e-12);
+    EXPECT_NEAR(frame.normal.x(), frames.normals.x(index), 1e-12);
+    EXPECT_NEAR(frame.normal.y(), frames.normals.y(index), 1e-12);
+    EXPECT_NEAR(frame.curvature, frames.curvatures(index), 1e-12);
+    EXPECT_NEAR(frame.curvatureRate, frames.curvatureRates(index), 1e-12);
+  }
+
+  // scalar transforms must provide the results of the array interface
+  const Transform<TypeParam::s_val> transform{
+      std::make_shared<Circle<TypeParam::s_val>>(this->m_circle)};
+  const Points<TypeParam::s_val> posCartes{
+      transform.posCartes(this->m_posFrenet)};
+  const Points<TypeParam::s_val> posFrenet{transform.posFrenet(posCartes)};
+
+  for (int index{}; index < this->s_numQueries; ++index) {
+    const Point posCartesEst{transform.posCartes(this->m_posFrenet(index))};
+    EXPECT_NEAR(posCartesEst.x(), posCartes.x(index), 1e-10);
+    EXPECT_NEAR(posCartesEst.y(), posCartes.y(index), 1e-10);
+
+    const Point posFrenetEst{transform.posFrenet(posCartes(index))};
+    EXPECT_NEAR(posFrenetEst.x(), posFrenet.x(index), 1e-10);
+    EXPECT_NEAR(posFrenetEst.y(), posFrenet.y(index), 1e-10);
+  }
+}
+
+TYPED_TEST(PathCircleTest, JacobiansPos) {
+  using PointsQueries = Points<TypeParam::s_val>;
+  const Transform<TypeParam::s_val> transform{
+      std::make_shared<Circle<TypeParam::s_val>>(this->m_circle)};
+  const PointsQueries posCartes{transform.posCartes(this->m_posFrenet)};
+
+  Jacobians<TypeParam::s_val> jacobians{};
+  const PointsQueries posCartesJac{
+      transform.posCartes(this->m_posFrenet, jacobians)};
+  this->expectAllClose(posCartesJac.x(), posCartes.x(), limits::min());
+  this->expectAllClose(posCartesJac.y(), posCartes.y(), limits::min());
+  expectJacobians(
+      [&transform](const PointsQueries &posFrenetPerturbed) {
+        return transform.posCartes(posFrenetPerturbed);
+      },
+      this->m_posFrenet, jacobians.pos);
+
+  const PointsQueries posFrenetJac{transform.posFrenet(posCartes, jacobians)};
+  this->expectAllClose(posFrenetJac.x(), this->m_posFrenet.x(), 1e-12);
+  this->expectAllClose(posFrenetJac.y(), this->m_posFrenet.y(), 1e-12);
+  expectJacobians(
+      [&transform](const PointsQueries &posCartesPerturbed) {
+        return transform.posFrenet(posCartesPerturbed);
+      },
+      posCartes, jacobians.pos);
+}
+
+TYPED_TEST(PathCircleTest, JacobiansVel) {
+  using PointsQueries = Points<TypeParam::s_val>;
+  using ArrayQueries = Eigen::Array<double, TypeParam::s_val, 1>;
+  const Transform<TypeParam::s_val> transform{
+      std::make_shared<Circle<TypeParam::s_val>>(this->m_circle)};
+  const PointsQueries vel{ArrayQueries::Random(this->s_numQueries),
+                          ArrayQueries::Random(this->s_numQueries)};
+  const auto &posFrenet{this->m_posFrenet};
+
+  Jacobians<TypeParam::s_val> jacobians{};
+  const PointsQueries velCartes{transform.velCartes(vel, posFrenet, jacobians)};
+  this->expectAllClose(velCartes.x(), transform.velCartes(vel, posFrenet).x(),
+                       limits::min());
+  expectJacobians(
+      [&transform, &posFrenet](const PointsQueries &velFrenetPerturbed) {
+        return transform.velCartes(velFrenetPerturbed, posFrenet);
+      },
+      vel, jacobians.velByVel);
+  expectJacobians(
+      [&transform, &vel](const PointsQueries &posFrenetPerturbed) {
+        return transform.velCartes(vel, posFrenetPerturbed);
+      },
+      posFrenet, jacobians.velByPos);
+
+  const PointsQueries velFrenet{transform.velFrenet(vel, posFrenet, jacobians)};
+  this->expectAllClose(velFrenet.x(), transform.velFrenet(vel, posFrenet).x(),
+                       limits::min());
+  expectJacobians(
+      [&transform, &posFrenet](const PointsQueries &velCartesPerturbed) {
+        return transform.velFrenet(velCartesPerturbed, posFrenet);
+      },
+      vel, jacobians.velByVel);
+  expectJacobians(
+      [&transform, &vel](const PointsQueries &posFrenetPerturbed) {
+        return transform.velFrenet(vel, posFrenetPerturbed);
+      },
+      posFrenet, jacobians.velByPos);
+}
 }; // namespace Internal
 }; // namespace FrenetTransform
 
@@ -13,6 +13,94 @@ TEST_F(PathPolylineLineTest, Lengths) {
 
   expectAllClose(lengthsGtr, lengthsEst, 1e-10);
 }
+
+TEST_F(PathPolylineLineTest, LengthsTree) {
+  auto polylineTree{m_polyline};
+  polylineTree.setSearch(Search::Tree);
+
+  const auto lengthsGtr{m_polyline.lengths(m_pointsCartes)};
+  const auto lengthsEst{polylineTree.lengths(m_pointsCartes)};
+
+  // search strategies must provide identical lengths
+  expectAllClose(lengthsGtr, lengthsEst, limits::min());
+}
+
+TEST_F(PathPolylineLineTest, LengthsCoarse) {
+  auto polylineCoarse{m_polyline};
+  polylineCoarse.setSearch(Search::Coarse);
+
+  const auto lengthsGtr{m_polyline.lengths(m_pointsCartes)};
+  const auto lengthsEst{polylineCoarse.lengths(m_pointsCartes)};
+
+  // search strategies must provide identical lengths
+  expectAllClose(lengthsGtr, lengthsEst, limits::min());
+}
+
+TEST_F(PathPolylineLineTest, LengthsGrid) {
+  auto polylineGrid{m_polyline};
+  polylineGrid.setSearch(Search::Grid);
+
+  const auto lengthsGtr{m_polyline.lengths(m_pointsCartes)};
+  const auto lengthsEst{polylineGrid.lengths(m_pointsCartes)};
+
+  // search strategies must provide identical lengths
+  expectAllClose(lengthsGtr, lengthsEst, limits::min());
+}
+
+TEST_F(PathPolylineLineTest, SinglePointLine) {
+  const auto lengths{m_line.lengths(m_pointsCartes)};
+  const auto frames{m_line.frames(lengths)};
+
+  // scalar evaluation must provide the results of the array interface
+  for (int index{}; index < m_pointsCartes.numPoints(); ++index) {
+    EXPECT_NEAR(m_line.length(m_pointsCartes(index)), lengths(index), 1e-14);
+    const Frame<double> frame{m_line.frame(lengths(index))};
+    EXPECT_NEAR(frame.point.x(), frames.points.x(index), 1e-14);
+    EXPECT_NEAR(frame.point.y(), frames.points.y(index), 1e-14);
+    EXPECT_NEAR(frame.tangent.x(), frames.tangents.x(index), 1e-14);
+    EXPECT_NEAR(frame.tangent.y(), frames.tangents.y(index), 1e-14);
+    EXPECT_NEAR(frame.normal.x(), frames.normals.x(index), 1e-14);
+    EXPECT_NEAR(frame.normal.y(), frames.normals.y(index), 1e-14);
+  }
+}
+
+TEST_F(PathPolylineLineTest, GetPointsLookup) {
+  auto polylineLookup{m_polyline};
+  // spacing exceeds shortest and falls below longest segment
+  polylineLookup.setLookup(0.6);
+
+  const Eigen::ArrayXd lengths{Eigen::ArrayXd::Random(100) * 2.0 + 1.0};
+  const auto pointsGtr{m_polyline(lengths)};
+  const auto pointsEst{polylineLookup(lengths)};
+
+  // segment lookup must provide identical points
+  expectAllClose(pointsGtr.x(), pointsEst.x(), limits::min());
+  expectAllClose(pointsGtr.y(), pointsEst.y(), limits::min());
+}
+
+TEST_F(PathPolylineLineTest, GetTangentsLookupVertices) {
+  // comb reversing at each vertex, such that the tangents identify the
+  // segment of a length
+  const int numPoints{40};
+  const Eigen::ArrayXd x{Eigen::ArrayXd::Zero(numPoints)};
+  Eigen::ArrayXd y{Eigen::ArrayXd::Zero(numPoints)};
+  for (int index{1}; index < numPoints; index += 2)
+    y(index) = 0.85;
+  const Polychain<Eigen::Dynamic> comb{x, y};
+  const Eigen::ArrayXd lengths{FrenetTransform::partialLength(x, y)};
+  const auto tangentsGtr{comb.tangent(lengths)};
+
+  // lengths of vertices divided by the spacing round up to bucket boundaries
+  for (const double spacing : {0.1, 0.2, 0.3, 0.37}) {
+    auto combLookup{comb};
+    combLookup.setLookup(spacing);
+    const auto tangentsEst{combLookup.tangent(lengths)};
+
+    // segment lookup must provide identical tangents
+    expectAllClose(tangentsEst.x(), tangentsGtr.x(), limits::min());
+    expectAllClose(tangentsEst.y(), tangentsGtr.y(), limits::min());
+  }
+}
 }; // namespace Internal
 }; // namespace FrenetTransform
 
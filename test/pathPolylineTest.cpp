@@ -9,12 +9,14 @@
 #include <gtest/gtest.h>
 #include <math.h>
 #include <memory>
+#include <utility>
 
 namespace FrenetTransform {
 namespace Internal {
 // template <typename NumPoints, typename NumQueries>
 template <typename Params>
-class PathPolylineTest : public PathCircleTest<Integral<Params::s_vals[1]>> {
+class PathPolylineTest
+    : public PathCircleStateTest<Integral<Params::s_vals[1]>> {
 public:
   using ArrayQueries = Eigen::Array<double, Params::s_vals[1], 1>;
   using ArrayPoints = Eigen::Array<double, Params::s_vals[0], 1>;
@@ -31,24 +33,62 @@ protected:
       std::make_shared<Polychain<Params::s_vals[0], Params::s_vals[1]>>(
           m_circlePoly)};
 
-  const Points<Params::s_vals[1]> m_posCartes{
-      this->m_transform.posCartes(this->m_posCircle)};
-
-  const Points<Params::s_vals[1], PointCircle> m_velCircle{
-      ArrayQueries::Random(this->s_numQueries).abs() * this->m_circle.radius(),
-      ArrayQueries::Random(this->s_numQueries) * M_PI / 4};
-  const Points<Params::s_vals[1]> m_velCartes{
-      this->m_transform.velCartes(this->m_velCircle, this->m_posCircle)};
-  const Points<Params::s_vals[1]> m_velFrenet{
-      this->m_transform.velFrenet(this->m_velCircle)};
-
-  const Points<Params::s_vals[1], PointCircle> m_accCircle{
-      ArrayQueries::Random(this->s_numQueries).abs() * this->m_circle.radius(),
-      ArrayQueries::Random(this->s_numQueries) * M_PI / 4};
-  const Points<Params::s_vals[1]> m_accCartes{this->m_transform.accCartes(
-      this->m_accCircle, this->m_velCircle, this->m_posCircle)};
-  const Points<Params::s_vals[1]> m_accFrenet{
-      this->m_transform.accFrenet(this->m_accCircle)};
+  using PointsFloat = Points<Params::s_vals[1], BasicPoint<float>>;
+
+  /**
+   * @brief Round points to single precision.
+   *
+   * @param points double precision points.
+   * @return PointsFloat points in single precision.
+   */
+  static PointsFloat toFloat(const Points<Params::s_vals[1]> &points) {
+    return {points.x().template cast<float>(),
+            points.y().template cast<float>()};
+  }
+
+  /**
+   * @brief Widen points to double precision.
+   *
+   * @param points single precision points.
+   * @return Points<Params::s_vals[1]> points in double precision.
+   */
+  static Points<Params::s_vals[1]> toDouble(const PointsFloat &points) {
+    return {points.x().template cast<double>(),
+            points.y().template cast<double>()};
+  }
+
+  /**
+   * @brief Collect the results of a single point transformation of each query
+   * point.
+   *
+   * @tparam Function callable mapping a query index to a Point.
+   * @param function single point transformation of a query index.
+   * @return Points<Params::s_vals[1]> results of all query points.
+   */
+  template <typename Function>
+  Points<Params::s_vals[1]> eachPoint(Function &&function) const {
+    ArrayQueries x(this->s_numQueries);
+    ArrayQueries y(this->s_numQueries);
+    for (int index{}; index < this->s_numQueries; ++index) {
+      const Point point{function(index)};
+      x(index) = point.x();
+      y(index) = point.y();
+    }
+    return {x, y};
+  }
+
+  /**
+   * @brief Expect single point results close to the results of the query
+   * points.
+   *
+   * @param estimate single point results.
+   * @param groundTruth results of the query points.
+   */
+  void expectPointsClose(const Points<Params::s_vals[1]> &estimate,
+                         const Points<Params::s_vals[1]> &groundTruth) {
+    this->expectAllClose(estimate.x(), groundTruth.x(), 1e-10);
+    this->expectAllClose(estimate.y(), groundTruth.y(), 1e-10);
+  }
 };
 
 using TestParams = testing::Types<
@@ -66,6 +106,36 @@ TYPED_TEST(PathPolylineTest, GetPointsCircle) {
   this->expectAllClose(pointsCircleEst.y(), pointsCircleGtr.y(), 1e-2);
 }
 
+TYPED_TEST(PathPolylineTest, GetPointsSortedCircle) {
+  using ArrayQueries = typename TestFixture::ArrayQueries;
+  const ArrayQueries lengthsSorted{ArrayQueries::LinSpaced(
+      this->s_numQueries, -1.0, 2 * M_PI * this->m_circle.radius() + 1.0)};
+  const ArrayQueries lengthsReversed{lengthsSorted.reverse()};
+
+  const auto pointsSorted{this->m_circlePoly(lengthsSorted)};
+  const auto pointsReversed{this->m_circlePoly(lengthsReversed)};
+
+  // walk along ascending lengths must match bisection of descending lengths
+  this->expectAllClose(pointsSorted.x(),
+                       ArrayQueries{pointsReversed.x().reverse()},
+                       limits::min());
+  this->expectAllClose(pointsSorted.y(),
+                       ArrayQueries{pointsReversed.y().reverse()},
+                       limits::min());
+}
+
+TYPED_TEST(PathPolylineTest, GetPointsLookupCircle) {
+  auto circlePolyLookup{this->m_circlePoly};
+  circlePolyLookup.setLookup(0.37);
+
+  const auto pointsEst{circlePolyLookup(this->m_posFrenet.x())};
+  const auto pointsGtr{this->m_circlePoly(this->m_posFrenet.x())};
+
+  // segment lookup must provide identical points
+  this->expectAllClose(pointsEst.x(), pointsGtr.x(), limits::min());
+  this->expectAllClose(pointsEst.y(), pointsGtr.y(), limits::min());
+}
+
 TYPED_TEST(PathPolylineTest, GetTangentsCircle) {
   const auto tangentsEst{this->m_circlePoly.tangent(this->m_posFrenet.x())};
   const auto tangentsGtr{this->m_circle.tangent(this->m_posFrenet.x())};
@@ -103,6 +173,31 @@ TYPED_TEST(PathPolylineTest, GetAngles2Circle) {
   this->expectAllClose(angles2Est, angles2Gtr, 1e-2);
 }
 
+TYPED_TEST(PathPolylineTest, GetFramesCircle) {
+  const auto &lengths{this->m_posFrenet.x()};
+  const auto frames{this->m_circlePoly.frames(lengths)};
+
+  // single pass must provide identical properties to separate evaluations
+  const auto points{this->m_circlePoly(lengths)};
+  const auto tangents{this->m_circlePoly.tangent(lengths)};
+  const auto normals{this->m_circlePoly.normal(lengths)};
+  this->expectAllClose(frames.points.x(), points.x(), limits::min());
+  this->expectAllClose(frames.points.y(), points.y(), limits::min());
+  this->expectAllClose(frames.tangents.x(), tangents.x(), limits::min());
+  this->expectAllClose(frames.tangents.y(), tangents.y(), limits::min());
+  this->expectAllClose(frames.normals.x(), normals.x(), limits::min());
+  this->expectAllClose(frames.normals.y(), normals.y(), limits::min());
+  this->expectAllClose(frames.curvatures, this->m_circlePoly.angle1(lengths),
+                       limits::min());
+  this->expectAllClose(frames.curvatureRates,
+                       this->m_circlePoly.angle2(lengths), limits::min());
+
+  // curvatures without other properties
+  const auto curvatures{
+      this->m_circlePoly.frames(lengths, FrameCurvatures).curvatures};
+  this->expectAllClose(curvatures, frames.curvatures, limits::min());
+}
+
 TYPED_TEST(PathPolylineTest, NextPointsCircle) {
   const auto lengthsEst{this->m_circlePoly.lengths(this->m_posCartes)};
   const auto lengthsGtr{this->m_circle.lengths(this->m_posCartes)};
@@ -110,6 +205,118 @@ TYPED_TEST(PathPolylineTest, NextPointsCircle) {
   this->expectAllClose(lengthsEst, lengthsGtr, 2e-2);
 }
 
+TYPED_TEST(PathPolylineTest, NextPointsTreeCircle) {
+  auto circlePolyTree{this->m_circlePoly};
+  circlePolyTree.setSearch(Search::Tree);
+
+  const auto lengthsEst{circlePolyTree.lengths(this->m_posCartes)};
+  const auto lengthsGtr{this->m_circlePoly.lengths(this->m_posCartes)};
+
+  // search strategies must provide identical lengths
+  this->expectAllClose(lengthsEst, lengthsGtr, limits::min());
+}
+
+TYPED_TEST(PathPolylineTest, NextPointsGridCircle) {
+  auto circlePolyGrid{this->m_circlePoly};
+  circlePolyGrid.setSearch(Search::Grid);
+
+  const auto lengthsEst{circlePolyGrid.lengths(this->m_posCartes)};
+  const auto lengthsGtr{this->m_circlePoly.lengths(this->m_posCartes)};
+
+  // search strategies must provide identical lengths
+  this->expectAllClose(lengthsEst, lengthsGtr, limits::min());
+}
+
+TYPED_TEST(PathPolylineTest, NextPointsCoarseCircle) {
+  auto circlePolyCoarse{this->m_circlePoly};
+  circlePolyCoarse.setSearch(Search::Coarse);
+  const auto lengthsGtr{this->m_circlePoly.lengths(this->m_posCartes)};
+
+  // automatic stride and stride not dividing the number of segments
+  for (const int stride : {0, 7}) {
+    circlePolyCoarse.setCoarseStride(stride);
+    const auto lengthsEst{circlePolyCoarse.lengths(this->m_posCartes)};
+
+    // search strategies must provide identical lengths
+    this->expectAllClose(lengthsEst, lengthsGtr, limits::min());
+  }
+}
+
+TYPED_TEST(PathPolylineTest, NextPointsAutoCircle) {
+  // automatic selection is opt-in
+  EXPECT_EQ(this->m_circlePoly.search(), Search::Linear);
+  auto circlePolyAuto{this->m_circlePoly};
+  circlePolyAuto.setSearch(Search::Auto);
+
+  // query points spread around the circle and close to its center, where
+  // the segments are at similar distances
+  const Points<TypeParam::s_vals[1]> pointsCenter{
+      this->m_posCartes.x() * 1e-2, this->m_posCartes.y() * 1e-2};
+  for (const auto &points : {this->m_posCartes, pointsCenter}) {
+    const auto lengthsEst{circlePolyAuto.lengths(points)};
+    const auto lengthsGtr{this->m_circlePoly.lengths(points)};
+
+    // automatic selection must not change lengths
+    this->expectAllClose(lengthsEst, lengthsGtr, limits::min());
+    for (int index{}; index < this->s_numQueries; ++index)
+      EXPECT_EQ(circlePolyAuto.length(points(index)), lengthsGtr(index));
+  }
+}
+
+TYPED_TEST(PathPolylineTest, NextPointsShiftedCircle) {
+  // large coordinates increase rounding differences of block projections
+  const Point offset{1e5, -3e5};
+  const Points<TypeParam::s_vals[0]> pointsShifted{
+      this->m_circleApprox(TestFixture::ArrayPoints::LinSpaced(
+                               this->s_numPoints, 0.0, 2 * M_PI) *
+                           this->m_circleApprox.radius()) +
+      offset};
+  const Polychain<TypeParam::s_vals[0], TypeParam::s_vals[1]> circlePoly{
+      pointsShifted};
+  const Polychain<TypeParam::s_vals[0], TypeParam::s_vals[1]> circlePolyTree{
+      pointsShifted, Search::Tree};
+
+  const auto lengthsEst{circlePoly.lengths(this->m_posCartes + offset)};
+  const auto lengthsGtr{circlePolyTree.lengths(this->m_posCartes + offset)};
+
+  // block projections must provide identical lengths to single projections
+  this->expectAllClose(lengthsEst, lengthsGtr, limits::min());
+}
+
+TYPED_TEST(PathPolylineTest, NextPointsRasterCircle) {
+  auto circlePolyRaster{this->m_circlePoly};
+  // raster only covers part of the query points
+  circlePolyRaster.setRaster({-6.0, -6.0}, {6.0, 2.0}, 0.25);
+
+  const auto lengthsEst{circlePolyRaster.lengths(this->m_posCartes)};
+  const auto lengthsGtr{this->m_circlePoly.lengths(this->m_posCartes)};
+
+  // raster candidates must provide identical lengths
+  this->expectAllClose(lengthsEst, lengthsGtr, limits::min());
+}
+
+TYPED_TEST(PathPolylineTest, NextPointsHintCircle) {
+  const auto lengthsGtr{this->m_circlePoly.lengths(this->m_posCartes)};
+  // hints deviate from previous lengths by small displacements
+  using ArrayQueries = typename TestFixture::ArrayQueries;
+  const ArrayQueries hints{lengthsGtr +
+                           ArrayQueries::Random(this->s_numQueries) * 1e-2};
+  const auto lengthsEst{
+      this->m_circlePoly.lengths(this->m_posCartes, hints, 5e-2)};
+
+  // local search must provide identical lengths next to the hints
+  this->expectAllClose(lengthsEst, lengthsGtr, limits::min());
+}
+
+TYPED_TEST(PathPolylineTest, PosFrenetHintCircle) {
+  // determine frenet positions close to ground truth lengths
+  const auto posFrenet{this->m_circleTransform.posFrenet(
+      this->m_posCartes, this->m_posFrenet.x(), 5e-2)};
+
+  this->expectAllClose(posFrenet.x(), this->m_posFrenet.x(), 4e-3);
+  this->expectAllClose(posFrenet.y(), this->m_posFrenet.y(), 4e-3);
+}
+
 TYPED_TEST(PathPolylineTest, PosFrenetCircle) {
   // determine frenet positions
   const auto posFrenet{this->m_circleTransform.posFrenet(this->m_posCartes)};
@@ -161,6 +368,262 @@ TYPED_TEST(PathPolylineTest, AccCartCircle) {
   this->expectAllClose(accCartes.x(), this->m_accCartes.x(), 5e-2);
   this->expectAllClose(accCartes.y(), this->m_accCartes.y(), 5e-2);
 }
+
+TYPED_TEST(PathPolylineTest, StateFrenetCircle) {
+  // single-call transform must match the separate transforms exactly
+  const auto states{this->m_circleTransform.stateFrenet(
+      this->m_posCartes, this->m_velCartes, this->m_accCartes)};
+  const auto posFrenet{this->m_circleTransform.posFrenet(this->m_posCartes)};
+  const auto velFrenet{
+      this->m_circleTransform.velFrenet(this->m_velCartes, posFrenet)};
+  const auto accFrenet{this->m_circleTransform.accFrenet(
+      this->m_accCartes, velFrenet, posFrenet)};
+
+  this->expectAllClose(states.pos.x(), posFrenet.x(), limits::min());
+  this->expectAllClose(states.pos.y(), posFrenet.y(), limits::min());
+  this->expectAllClose(states.vel.x(), velFrenet.x(), limits::min());
+  this->expectAllClose(states.vel.y(), velFrenet.y(), limits::min());
+  this->expectAllClose(states.acc.x(), accFrenet.x(), limits::min());
+  this->expectAllClose(states.acc.y(), accFrenet.y(), limits::min());
+}
+
+TYPED_TEST(PathPolylineTest, StateFrenetHintCircle) {
+  // local search close to ground truth lengths
+  const auto states{this->m_circleTransform.stateFrenet(
+      this->m_posCartes, this->m_velCartes, this->m_accCartes,
+      this->m_posFrenet.x(), 5e-2)};
+  const auto posFrenet{this->m_circleTransform.posFrenet(
+      this->m_posCartes, this->m_posFrenet.x(), 5e-2)};
+
+  this->expectAllClose(states.pos.x(), posFrenet.x(), limits::min());
+  this->expectAllClose(states.pos.y(), posFrenet.y(), limits::min());
+}
+
+TYPED_TEST(PathPolylineTest, StateCartesCircle) {
+  // single-call transform must match the separate transforms exactly
+  const auto states{this->m_circleTransform.stateCartes(
+      this->m_posFrenet, this->m_velFrenet, this->m_accFrenet)};
+  const auto posCartes{this->m_circleTransform.posCartes(this->m_posFrenet)};
+  const auto velCartes{
+      this->m_circleTransform.velCartes(this->m_velFrenet, this->m_posFrenet)};
+  const auto accCartes{this->m_circleTransform.accCartes(
+      this->m_accFrenet, this->m_velFrenet, this->m_posFrenet)};
+
+  this->expectAllClose(states.pos.x(), posCartes.x(), limits::min());
+  this->expectAllClose(states.pos.y(), posCartes.y(), limits::min());
+  this->expectAllClose(states.vel.x(), velCartes.x(), limits::min());
+  this->expectAllClose(states.vel.y(), velCartes.y(), limits::min());
+  this->expectAllClose(states.acc.x(), accCartes.x(), limits::min());
+  this->expectAllClose(states.acc.y(), accCartes.y(), limits::min());
+}
+
+TYPED_TEST(PathPolylineTest, StaticDispatchCircle) {
+  // path bound at compile time must match the virtual dispatch
+  using PolychainType = Polychain<TypeParam::s_vals[0], TypeParam::s_vals[1]>;
+  const Transform<TypeParam::s_vals[1], PolychainType> circleTransform{
+      std::make_shared<PolychainType>(this->m_circlePoly)};
+
+  const auto statesFrenet{circleTransform.stateFrenet(
+      this->m_posCartes, this->m_velCartes, this->m_accCartes)};
+  const auto statesFrenetGtr{this->m_circleTransform.stateFrenet(
+      this->m_posCartes, this->m_velCartes, this->m_accCartes)};
+  const auto statesCartes{circleTransform.stateCartes(
+      this->m_posFrenet, this->m_velFrenet, this->m_accFrenet)};
+  const auto statesCartesGtr{this->m_circleTransform.stateCartes(
+      this->m_posFrenet, this->m_velFrenet, this->m_accFrenet)};
+
+  this->expectAllClose(statesFrenet.pos.x(), statesFrenetGtr.pos.x(), 1e-12);
+  this->expectAllClose(statesFrenet.pos.y(), statesFrenetGtr.pos.y(), 1e-12);
+  this->expectAllClose(statesFrenet.vel.x(), statesFrenetGtr.vel.x(), 1e-12);
+  this->expectAllClose(statesFrenet.vel.y(), statesFrenetGtr.vel.y(), 1e-12);
+  this->expectAllClose(statesFrenet.acc.x(), statesFrenetGtr.acc.x(), 1e-12);
+  this->expectAllClose(statesFrenet.acc.y(), statesFrenetGtr.acc.y(), 1e-12);
+  this->expectAllClose(statesCartes.pos.x(), statesCartesGtr.pos.x(), 1e-12);
+  this->expectAllClose(statesCartes.pos.y(), statesCartesGtr.pos.y(), 1e-12);
+  this->expectAllClose(statesCartes.vel.x(), statesCartesGtr.vel.x(), 1e-12);
+  this->expectAllClose(statesCartes.vel.y(), statesCartesGtr.vel.y(), 1e-12);
+  this->expectAllClose(statesCartes.acc.x(), statesCartesGtr.acc.x(), 1e-12);
+  this->expectAllClose(statesCartes.acc.y(), statesCartesGtr.acc.y(), 1e-12);
+}
+
+TYPED_TEST(PathPolylineTest, FrameSetCircle) {
+  // frames bound once must match the transforms evaluating the path
+  const auto frameSet{this->m_circleTransform.frameSet(this->m_posFrenet)};
+  EXPECT_EQ(frameSet.numQueries(), this->m_posFrenet.numPoints());
+
+  const Points<TypeParam::s_vals[1]> velCartes{
+      frameSet.velCartes(this->m_velFrenet)};
+  const auto velCartesGtr{this->m_circleTransform.velCartes(
+      this->m_velFrenet, this->m_posFrenet)};
+  const Points<TypeParam::s_vals[1]> velFrenet{
+      frameSet.velFrenet(this->m_velCartes)};
+  const auto velFrenetGtr{this->m_circleTransform.velFrenet(
+      this->m_velCartes, this->m_posFrenet)};
+  const Points<TypeParam::s_vals[1]> accCartes{
+      frameSet.accCartes(this->m_accFrenet, this->m_velFrenet)};
+  const auto accCartesGtr{this->m_circleTransform.accCartes(
+      this->m_accFrenet, this->m_velFrenet, this->m_posFrenet)};
+  const Points<TypeParam::s_vals[1]> accFrenet{
+      frameSet.accFrenet(this->m_accCartes, this->m_velFrenet)};
+  const auto accFrenetGtr{this->m_circleTransform.accFrenet(
+      this->m_accCartes, this->m_velFrenet, this->m_posFrenet)};
+
+  this->expectAllClose(velCartes.x(), velCartesGtr.x(), 1e-10);
+  this->expectAllClose(velCartes.y(), velCartesGtr.y(), 1e-10);
+  this->expectAllClose(velFrenet.x(), velFrenetGtr.x(), 1e-10);
+  this->expectAllClose(velFrenet.y(), velFrenetGtr.y(), 1e-10);
+  this->expectAllClose(accCartes.x(), accCartesGtr.x(), 1e-10);
+  this->expectAllClose(accCartes.y(), accCartesGtr.y(), 1e-10);
+  this->expectAllClose(accFrenet.x(), accFrenetGtr.x(), 1e-10);
+  this->expectAllClose(accFrenet.y(), accFrenetGtr.y(), 1e-10);
+}
+
+TYPED_TEST(PathPolylineTest, SinglePointCircle) {
+  // single point transformations must match the transformations of all query
+  // points
+  const auto &transform{this->m_circleTransform};
+  const auto &posCartes{this->m_posCartes};
+  const auto &posFrenet{this->m_posFrenet};
+  const auto &velCartes{this->m_velCartes};
+  const auto &velFrenet{this->m_velFrenet};
+  const auto &accCartes{this->m_accCartes};
+  const auto &accFrenet{this->m_accFrenet};
+
+  const auto posFrenetEst{this->eachPoint(
+      [&](int index) { return transform.posFrenet(posCartes(index)); })};
+  this->expectPointsClose(posFrenetEst, transform.posFrenet(posCartes));
+
+  const auto posFrenetHintEst{this->eachPoint([&](int index) {
+    return transform.posFrenet(posCartes(index), posFrenet.x(index), 5e-2);
+  })};
+  this->expectPointsClose(posFrenetHintEst,
+                          transform.posFrenet(posCartes, posFrenet.x(), 5e-2));
+
+  const auto posCartesEst{this->eachPoint(
+      [&](int index) { return transform.posCartes(posFrenet(index)); })};
+  this->expectPointsClose(posCartesEst, transform.posCartes(posFrenet));
+
+  const auto velFrenetEst{this->eachPoint([&](int index) {
+    return transform.velFrenet(velCartes(index), posFrenet(index));
+  })};
+  this->expectPointsClose(velFrenetEst,
+                          transform.velFrenet(velCartes, posFrenet));
+
+  const auto velCartesEst{this->eachPoint([&](int index) {
+    return transform.velCartes(velFrenet(index), posFrenet(index));
+  })};
+  this->expectPointsClose(velCartesEst,
+                          transform.velCartes(velFrenet, posFrenet));
+
+  const auto accFrenetEst{this->eachPoint([&](int index) {
+    return transform.accFrenet(accCartes(index), velFrenet(index),
+                               posFrenet(index));
+  })};
+  this->expectPointsClose(accFrenetEst,
+                          transform.accFrenet(accCartes, velFrenet, posFrenet));
+
+  const auto accCartesEst{this->eachPoint([&](int index) {
+    return transform.accCartes(accFrenet(index), velFrenet(index),
+                               posFrenet(index));
+  })};
+  this->expectPointsClose(accCartesEst,
+                          transform.accCartes(accFrenet, velFrenet, posFrenet));
+
+  // states evaluate the path once for all derivatives
+  const auto statesFrenet{
+      transform.stateFrenet(posCartes, velCartes, accCartes)};
+  const auto accStateFrenetEst{this->eachPoint([&](int index) {
+    return transform
+        .stateFrenet(posCartes(index), velCartes(index), accCartes(index))
+        .acc;
+  })};
+  this->expectPointsClose(accStateFrenetEst, statesFrenet.acc);
+
+  const auto statesCartes{
+      transform.stateCartes(posFrenet, velFrenet, accFrenet)};
+  const auto accStateCartesEst{this->eachPoint([&](int index) {
+    return transform
+        .stateCartes(posFrenet(index), velFrenet(index), accFrenet(index))
+        .acc;
+  })};
+  this->expectPointsClose(accStateCartesEst, statesCartes.acc);
+}
+
+TYPED_TEST(PathPolylineTest, NextPointsFloatCircle) {
+  // single precision queries search the double precision polychain, such
+  // that the lengths are the rounded lengths of the widened queries
+  const Polychain<TypeParam::s_vals[0], TypeParam::s_vals[1], float> circlePoly{
+      this->m_circleApprox(
+          TestFixture::ArrayPoints::LinSpaced(this->s_numPoints, 0.0,
+                                              2 * M_PI) *
+          this->m_circleApprox.radius())};
+  const auto posCartes{this->toFloat(this->m_posCartes)};
+
+  const auto lengths{circlePoly.lengths(posCartes)};
+  const auto lengthsGtr{this->m_circlePoly.lengths(this->toDouble(posCartes))};
+
+  this->expectAllClose(lengths, lengthsGtr.template cast<float>().eval(),
+                       limits::min());
+}
+
+TYPED_TEST(PathPolylineTest, StateFloatCircle) {
+  // single precision transform close to the double precision transform
+  using PolychainType =
+      Polychain<TypeParam::s_vals[0], TypeParam::s_vals[1], float>;
+  const Transform<TypeParam::s_vals[1], PolychainType> circleTransform{
+      std::make_shared<PolychainType>(this->m_circleApprox(
+          TestFixture::ArrayPoints::LinSpaced(this->s_numPoints, 0.0,
+                                              2 * M_PI) *
+          this->m_circleApprox.radius()))};
+
+  const auto statesFrenet{circleTransform.stateFrenet(
+      this->toFloat(this->m_posCartes), this->toFloat(this->m_velCartes),
+      this->toFloat(this->m_accCartes))};
+  const auto statesFrenetGtr{this->m_circleTransform.stateFrenet(
+      this->m_posCartes, this->m_velCartes, this->m_accCartes)};
+  const auto statesCartes{circleTransform.stateCartes(
+      this->toFloat(this->m_posFrenet), this->toFloat(this->m_velFrenet),
+      this->toFloat(this->m_accFrenet))};
+  const auto statesCartesGtr{this->m_circleTransform.stateCartes(
+      this->m_posFrenet, this->m_velFrenet, this->m_accFrenet)};
+
+  for (const auto &[states, statesGtr] :
+       {std::pair{&statesFrenet, &statesFrenetGtr},
+        std::pair{&statesCartes, &statesCartesGtr}}) {
+    // positions only differ by rounding, velocities and accelerations may
+    // evaluate the neighboring segment of the polychain if rounded lengths
+    // cross a polychain point
+    this->expectAllClose(this->toDouble(states->pos).x(), statesGtr->pos.x(),
+                         1e-4);
+    this->expectAllClose(this->toDouble(states->pos).y(), statesGtr->pos.y(),
+                         1e-4);
+    this->expectAllClose(this->toDouble(states->vel).x(), statesGtr->vel.x(),
+                         5e-2);
+    this->expectAllClose(this->toDouble(states->vel).y(), statesGtr->vel.y(),
+                         5e-2);
+    this->expectAllClose(this->toDouble(states->acc).x(), statesGtr->acc.x(),
+                         5e-2);
+    this->expectAllClose(this->toDouble(states->acc).y(), statesGtr->acc.y(),
+                         5e-2);
+  }
+}
+
+TEST(PathPolyline, FramesTwoPoints) {
+  // gradients of orders beyond the polychain points vanish instead of reading
+  // past the points
+  const Polychain<Eigen::Dynamic> line{Eigen::ArrayXd{{0.0, 2.0}},
+                                       Eigen::ArrayXd{{1.0, 1.0}}};
+  const Eigen::ArrayXd lengths{Eigen::ArrayXd::LinSpaced(5, -0.5, 2.5)};
+
+  const auto frames{line.frames(lengths)};
+
+  for (int index{}; index < lengths.rows(); ++index) {
+    EXPECT_EQ(frames.tangents.x(index), 1.0);
+    EXPECT_EQ(frames.tangents.y(index), 0.0);
+    EXPECT_EQ(frames.curvatures(index), 0.0);
+    EXPECT_EQ(frames.curvatureRates(index), 0.0);
+  }
+}
 }; // namespace Internal
 }; // namespace FrenetTransform
 
@@ -0,0 +1,128 @@
+#include "frenetTransform/point.h"
+#include "frenetTransform/points.h"
+
+#include <Eigen/Core>
+#include <gtest/gtest.h>
+#include <type_traits>
+
+namespace FrenetTransform {
+namespace Internal {
+/**
+ * @brief Test that operators on Points build lazy expressions.
+ *
+ */
+TEST(Points, Lazy) {
+  using Points5 = Points<5>;
+  static_assert(!std::is_same_v<decltype(-Points5{}), Points5>);
+  static_assert(!std::is_same_v<decltype(Points5{} + Points5{}), Points5>);
+  static_assert(!std::is_same_v<decltype(Points5{} - Point{}), Points5>);
+  static_assert(
+      !std::is_same_v<decltype(Points5{} * Points5::ArrayPoints{}), Points5>);
+}
+
+/**
+ * @brief Test that expressions over temporary Points outlive the statement
+ * building them.
+ *
+ */
+TEST(Points, Temporaries) {
+  const Points<3> points{Eigen::Array3d{1.0, 2.0, 3.0},
+                         Eigen::Array3d{4.0, 5.0, 6.0}};
+  const auto make{[&points]() { return points; }};
+  const auto sum{make() + points};
+  const auto chain{-(make() * Eigen::Array3d{2.0, 0.0, 1.0}) - Point{1.0, 1.0}};
+  const Eigen::Array3d scalar{make() * points};
+
+  EXPECT_EQ(sum.x()(2), 6.0);
+  EXPECT_EQ(sum.y()(0), 8.0);
+  EXPECT_EQ(chain(0).x(), -3.0);
+  EXPECT_EQ(chain(1).y(), -1.0);
+  EXPECT_EQ(chain.numPoints(), 3);
+  EXPECT_EQ(scalar(1), 29.0);
+}
+
+/**
+ * @brief Test element-wise operators against coordinate-wise ground truth.
+ *
+ */
+TEST(Points, Operators) {
+  const Eigen::Array<double, 5, 1> x1{1, 2, 5, 1, 3};
+  const Eigen::Array<double, 5, 1> y1{2, 2, 5, 1, 3};
+  const Eigen::Array<double, 5, 1> x2{0, 1, 3, -4, 2};
+  const Eigen::Array<double, 5, 1> y2{0, 0, 3, -4, 2};
+  const Points<5> points1{x1, y1};
+  const Points<5> points2{x2, y2};
+  const Point point{0.5, -1.5};
+
+  const Points<5> neg{-points1};
+  const Points<5> sum{points1 + points2};
+  const Points<5> sumPoint{points1 + point};
+  const Points<5> pointSum{point + points1};
+  const Points<5> diff{points1 - points2};
+  const Points<5> diffPoint{points1 - point};
+  const Points<5> pointDiff{point - points1};
+  const Eigen::Array<double, 5, 1> scalar{points1 * points2};
+  const Points<5> prod{points1 * x2};
+  const Points<5> prodNums{x2 * points1};
+  // chain evaluated in a single expression
+  const Points<5> chain{points1 + points2 * y1 - point};
+
+  for (int index{}; index < 5; ++index) {
+    EXPECT_EQ(neg.x(index), -x1(index));
+    EXPECT_EQ(neg.y(index), -y1(index));
+    EXPECT_EQ(sum.x(index), x1(index) + x2(index));
+    EXPECT_EQ(sum.y(index), y1(index) + y2(index));
+    EXPECT_EQ(sumPoint.x(index), x1(index) + point.x());
+    EXPECT_EQ(sumPoint.y(index), y1(index) + point.y());
+    EXPECT_EQ(pointSum.x(index), sumPoint.x(index));
+    EXPECT_EQ(pointSum.y(index), sumPoint.y(index));
+    EXPECT_EQ(diff.x(index), x1(index) - x2(index));
+    EXPECT_EQ(diff.y(index), y1(index) - y2(index));
+    EXPECT_EQ(diffPoint.x(index), x1(index) - point.x());
+    EXPECT_EQ(diffPoint.y(index), y1(index) - point.y());
+    EXPECT_EQ(pointDiff.x(index), point.x() - x1(index));
+    EXPECT_EQ(pointDiff.y(index), point.y() - y1(index));
+    EXPECT_EQ(scalar(index), x1(index) * x2(index) + y1(index) * y2(index));
+    EXPECT_EQ(prod.x(index), x1(index) * x2(index));
+    EXPECT_EQ(prod.y(index), y1(index) * x2(index));
+    EXPECT_EQ(prodNums.x(index), prod.x(index));
+    EXPECT_EQ(prodNums.y(index), prod.y(index));
+    EXPECT_EQ(chain.x(index), x1(index) + x2(index) * y1(index) - point.x());
+    EXPECT_EQ(chain.y(index), y1(index) + y2(index) * y1(index) - point.y());
+  }
+}
+
+/**
+ * @brief Test that expressions provide points without evaluating Points.
+ *
+ */
+TEST(Points, ExpressionAccess) {
+  const Points<Eigen::Dynamic> points{Eigen::ArrayXd::LinSpaced(4, 0.0, 3.0),
+                                      Eigen::ArrayXd::LinSpaced(4, 1.0, 4.0)};
+  const auto shifted{points + Point{1.0, -1.0}};
+
+  EXPECT_EQ(shifted.numPoints(), 4);
+  EXPECT_EQ(shifted(2).x(), 3.0);
+  EXPECT_EQ(shifted(2).y(), 2.0);
+}
+
+/**
+ * @brief Test single precision points and their conversion to double.
+ *
+ */
+TEST(Points, Scalar) {
+  using PointsFloat = Points<3, BasicPoint<float>>;
+  static_assert(std::is_same_v<PointsFloat::ArrayPoints::Scalar, float>);
+
+  const PointsFloat points{Eigen::Array3f{1.5f, -2.0f, 0.1f},
+                           Eigen::Array3f{0.0f, 3.0f, -0.1f}};
+  const PointsFloat shifted{points - BasicPoint<float>{0.5f, 1.0f}};
+  const Point point{points(2)};
+
+  EXPECT_EQ(shifted.x(0), 1.0f);
+  EXPECT_EQ(shifted.y(1), 2.0f);
+  EXPECT_EQ(point.x(), static_cast<double>(0.1f));
+  EXPECT_EQ(point.y(), static_cast<double>(-0.1f));
+}
+}; // namespace Internal
+}; // namespace FrenetTransform
@@ -0,0 +1,92 @@
+#include "frenetTransform/arcChain.h"
+#include "frenetTransform/points.h"
+#include "frenetTransform/polychain.h"
+#include "frenetTransform/resample.h"
+#include "frenetTransform/test/testBase.h"
+#include "frenetTransform/transform.h"
+
+#include <Eigen/Core>
+#include <gtest/gtest.h>
+#include <math.h>
+#include <memory>
+
+namespace FrenetTransform {
+namespace Internal {
+class ResampleTest : public TestBase {
+protected:
+  // straight, quarter circle of radius 20 and straight
+  static constexpr double s_trackLength{100.0 + 10 * M_PI};
+  const ArcChain<> m_track{
+      Point{0.0, 0.0}, 0.0,
+      Eigen::Array4d{0.0, 50.0, 50.0 + 10 * M_PI, s_trackLength},
+      Eigen::Array3d{0.0, 0.05, 0.0}};
+
+  /**
+   * @brief Maximum error of Cartesian positions with lateral offsets along a
+   * polychain through points of the track.
+   *
+   * @param lengths lengths of the polychain points along the track.
+   * @return double maximum distance to the positions along the track.
+   */
+  double errorMax(const Eigen::ArrayXd &lengths) const {
+    std::srand(0);
+    const Points<Eigen::Dynamic> posFrenet{
+        (Eigen::ArrayXd::Random(512) + 1) / 2 * s_trackLength,
+        Eigen::ArrayXd::Random(512) * 10.0};
+    const Transform<> exact{std::make_shared<ArcChain<>>(m_track)};
+    const Transform<> approx{
+        std::make_shared<Polychain<Eigen::Dynamic>>(m_track(lengths))};
+    const Points<Eigen::Dynamic> diff{exact.posCartes(posFrenet) -
+                                      approx.posCartes(posFrenet)};
+    return (diff.x().pow(2) + diff.y().pow(2)).sqrt().maxCoeff();
+  }
+};
+
+TEST_F(ResampleTest, ConstantCurvature) {
+  const double radius{5.0};
+  const ArcChain<> circle{
+      Point{radius, 0.0}, M_PI / 2,
+      Eigen::ArrayXd::LinSpaced(5, 0.0, 2 * M_PI * radius),
+      Eigen::ArrayXd::Constant(4, 1 / radius)};
+  const Eigen::ArrayXd lengths{resample(circle, 0.0, 2 * M_PI * radius, 33)};
+
+  expectAllClose(
+      lengths,
+      Eigen::ArrayXd{Eigen::ArrayXd::LinSpaced(33, 0.0, 2 * M_PI * radius)},
+      1e-12);
+}
+
+TEST_F(ResampleTest, StraightLine) {
+  const Polychain<Eigen::Dynamic> line{Eigen::Array2d{0.0, 3.0},
+                                       Eigen::Array2d{0.0, 4.0}};
+  const Eigen::ArrayXd lengths{resample(line, 1.0, 5.0, 9)};
+
+  expectAllClose(lengths,
+                 Eigen::ArrayXd{Eigen::ArrayXd::LinSpaced(9, 1.0, 5.0)}, 1e-12);
+}
+
+TEST_F(ResampleTest, Track) {
+  for (const double growthMax : {1.25, 2.0}) {
+    const Eigen::ArrayXd lengths{
+        resample(m_track, 0.0, s_trackLength, 64, growthMax)};
+    ASSERT_EQ(lengths.rows(), 64);
+    EXPECT_EQ(lengths(0), 0.0);
+    EXPECT_EQ(lengths(63), s_trackLength);
+
+    // spacings grade from the arc into the straights
+    const Eigen::ArrayXd spacings{lengths.tail(63) - lengths.head(63)};
+    EXPECT_GT(spacings.minCoeff(), 0.0);
+    const Eigen::ArrayXd ratios{spacings.tail(62) / spacings.head(62)};
+    EXPECT_LE(ratios.max(ratios.inverse()).maxCoeff(), growthMax * 1.05);
+    const int arc{firstSorted(lengths, 50.0 + 5 * M_PI)};
+    EXPECT_LT(spacings(arc), spacings(0) / 4);
+    EXPECT_LT(spacings(arc), spacings(62) / 4);
+
+    // denser points along the arc at least halve the error of uniform ones
+    EXPECT_LT(errorMax(lengths),
+              errorMax(Eigen::ArrayXd::LinSpaced(64, 0.0, s_trackLength)) /
+                  2);
+  }
+}
+}; // namespace Internal
+}; // namespace FrenetTransform
@@ -0,0 +1,97 @@
+#include "frenetTransform/arcChain.h"
+#include "frenetTransform/points.h"
+#include "frenetTransform/polychain.h"
+#include "frenetTransform/simplify.h"
+#include "frenetTransform/test/testBase.h"
+
+#include <Eigen/Core>
+#include <gtest/gtest.h>
+#include <math.h>
+
+namespace FrenetTransform {
+namespace Internal {
+class SimplifyTest : public TestBase {
+protected:
+  // straight, quarter circle of radius 20 and straight sampled every 10 cm
+  const ArcChain<> m_track{Point{0.0, 0.0}, 0.0,
+                           Eigen::Array4d{0.0, 50.0, 50.0 + 10 * M_PI,
+                                          100.0 + 10 * M_PI},
+                           Eigen::Array3d{0.0, 0.05, 0.0}};
+  const Points<Eigen::Dynamic> m_points{m_track(
+      Eigen::ArrayXd::LinSpaced(1001 + 314, 0.0, 100.0 + 10 * M_PI))};
+
+  /**
+   * @brief Maximum distance of points to a polychain.
+   *
+   * @param points query points.
+   * @param polychain polychain to project the points onto.
+   * @return double maximum distance.
+   */
+  static double distanceMax(const Points<Eigen::Dynamic> &points,
+                            const Polychain<Eigen::Dynamic> &polychain) {
+    const Points<Eigen::Dynamic> projections{
+        polychain(polychain.lengths(points))};
+    return ((points.x() - projections.x()).pow(2) +
+            (points.y() - projections.y()).pow(2))
+        .sqrt()
+        .maxCoeff();
+  }
+};
+
+TEST_F(SimplifyTest, StraightLine) {
+  const Eigen::ArrayXd params{Eigen::ArrayXd::LinSpaced(101, 0.0, 10.0)};
+  const Simplified line{simplify(params * 3.0, params * 4.0, 1e-9, 1e-9)};
+
+  ASSERT_EQ(line.indices.rows(), 2);
+  EXPECT_EQ(line.indices(0), 0);
+  EXPECT_EQ(line.indices(1), 100);
+  EXPECT_NEAR(line.deviation, 0.0, 1e-12);
+  EXPECT_NEAR(line.curvatureError, 0.0, 1e-12);
+}
+
+TEST_F(SimplifyTest, FewPoints) {
+  const Simplified segment{
+      simplify(Eigen::Array2d{0.0, 1.0}, Eigen::Array2d{0.0, 1.0}, 1.0)};
+
+  EXPECT_EQ(segment.indices.rows(), 2);
+  EXPECT_EQ(segment.points.numPoints(), 2);
+}
+
+TEST_F(SimplifyTest, DeviationBound) {
+  for (const double deviationMax : {1e-1, 1e-2, 1e-3}) {
+    const Simplified track{
+        simplify(m_points.x(), m_points.y(), deviationMax)};
+
+    // straights collapse to their ends
+    EXPECT_LT(track.indices.rows(), m_points.numPoints() / 4);
+    EXPECT_LE(track.deviation, deviationMax);
+    EXPECT_NEAR(distanceMax(m_points, Polychain<Eigen::Dynamic>{track.points}),
+                track.deviation, 1e-12);
+  }
+}
+
+TEST_F(SimplifyTest, CurvatureBound) {
+  const Simplified coarse{simplify(m_points.x(), m_points.y(), 1e-2)};
+  const Simplified fine{simplify(m_points.x(), m_points.y(), 1e-2, 2e-2)};
+
+  // curvature bound keeps additional points
+  EXPECT_GT(coarse.curvatureError, 2e-2);
+  EXPECT_LE(fine.curvatureError, 2e-2);
+  EXPECT_GT(fine.indices.rows(), coarse.indices.rows());
+  EXPECT_LT(fine.indices.rows(), m_points.numPoints() / 4);
+  EXPECT_LE(fine.deviation, 1e-2);
+}
+
+TEST_F(SimplifyTest, CurvatureBoundSampling) {
+  // steps of the curvature by less than the sampling allows keep all points
+  // of the arc, which meets any bound
+  for (const double curvatureErrorMax : {1.5e-2, 1e-3}) {
+    const Simplified track{
+        simplify(m_points.x(), m_points.y(), 1e-2, curvatureErrorMax)};
+
+    EXPECT_LE(track.curvatureError, curvatureErrorMax);
+    EXPECT_LT(track.indices.rows(), m_points.numPoints() / 2);
+  }
+}
+}; // namespace Internal
+}; // namespace FrenetTransform
@@ -0,0 +1,103 @@
+#include "frenetTransform/internal/circle.h"
+#include "frenetTransform/internal/constexprTypes.h"
+#include "frenetTransform/points.h"
+#include "frenetTransform/spline.h"
+#include "frenetTransform/test/pathCircleApproxTest.h"
+
+#include <Eigen/Core>
+#include <gtest/gtest.h>
+#include <math.h>
+
+namespace FrenetTransform {
+namespace Internal {
+/**
+ * @brief Spline through points on the circle.
+ *
+ * @tparam NumQueries number of query points.
+ */
+template <typename NumQueries> struct SplineCircle {
+  using Queries = NumQueries;
+  using PathType = Spline<NumQueries::s_val>;
+
+  // far fewer points than the polychains approximating the same circle
+  static constexpr int s_numPoints{33};
+
+  // errors of frenet frame results grow with distance from path
+  static constexpr CircleTolerances s_tolerances{.points = 1e-5,
+                                                 .tangents = 1e-4,
+                                                 .angles1 = 1e-4,
+                                                 .angles2 = 1e-3,
+                                                 .curvatureRates = 1e-12,
+                                                 .lengths = 1e-3,
+                                                 .posFrenet = 1e-3,
+                                                 .velFrenet = 1e-2,
+                                                 .accFrenet = 2e-2,
+                                                 .accCartes = 1e-2};
+
+  static PathType approximate(double radius) {
+    const Circle<Eigen::Dynamic> circle{radius, {0.0, 0.0}, -M_PI};
+    return PathType{Points<Eigen::Dynamic>{
+        circle(Eigen::ArrayXd::LinSpaced(s_numPoints, 0.0, 2 * M_PI) *
+               radius)}};
+  }
+};
+
+using SplineCircles = testing::Types<SplineCircle<Integral<Eigen::Dynamic>>,
+                                     SplineCircle<Integral<100>>>;
+INSTANTIATE_TYPED_TEST_SUITE_P(Spline, PathCircleApproxTest, SplineCircles);
+
+template <typename NumQueries>
+class SplineTest : public PathCircleApproxTest<SplineCircle<NumQueries>> {
+public:
+  static constexpr int s_numPoints{SplineCircle<NumQueries>::s_numPoints};
+
+protected:
+  const Circle<Eigen::Dynamic> m_circleApprox{5.0, {0.0, 0.0}, -M_PI};
+  const Points<Eigen::Dynamic> m_points{
+      m_circleApprox(Eigen::ArrayXd::LinSpaced(s_numPoints, 0.0, 2 * M_PI) *
+                     m_circleApprox.radius())};
+};
+
+using Queries = testing::Types<Integral<Eigen::Dynamic>, Integral<100>>;
+TYPED_TEST_SUITE(SplineTest, Queries);
+
+TYPED_TEST(SplineTest, KnotsCircle) {
+  const Spline<Eigen::Dynamic> spline{this->m_points};
+  const Eigen::ArrayXd &knotLengths{spline.knotLengths()};
+  const Points<Eigen::Dynamic> knots{spline(knotLengths)};
+
+  // spline interpolates the points at the refitted arc lengths
+  this->expectAllClose(knots.x(), this->m_points.x(), 1e-12);
+  this->expectAllClose(knots.y(), this->m_points.y(), 1e-12);
+  const Eigen::ArrayXd arcLengths{
+      Eigen::ArrayXd::LinSpaced(this->s_numPoints, 0.0, 2 * M_PI) *
+      this->m_circleApprox.radius()};
+  this->expectAllClose(knotLengths, arcLengths, 1e-5);
+}
+
+TYPED_TEST(SplineTest, FewPointsLine) {
+  // spans of few points fall back to lower polynomial degrees
+  for (const int numPoints : {2, 3, 5}) {
+    const Eigen::ArrayXd params{Eigen::ArrayXd::LinSpaced(numPoints, 0, 1)};
+    const Spline<TypeParam::s_val> line{params * 3.0, params * 4.0};
+    this->expectAllClose(line.knotLengths(),
+                         Eigen::ArrayXd{params * 5.0}, 1e-12);
+
+    const Point point{line.frame(2.5).point};
+    EXPECT_NEAR(point.x(), 1.5, 1e-12);
+    EXPECT_NEAR(point.y(), 2.0, 1e-12);
+    EXPECT_NEAR(line.frame(2.5).curvature, 0.0, 1e-12);
+    EXPECT_NEAR(line.length(Point{1.5 - 4.0, 2.0 + 3.0}), 2.5, 1e-12);
+  }
+}
+
+TYPED_TEST(SplineTest, SingleFrameCircle) {
+  for (int index{}; index < this->s_numQueries; ++index) {
+    const Frame<double> frame{
+        this->m_circlePath.frame(this->m_posFrenet.x(index))};
+    EXPECT_NEAR(frame.curvature, 1 / this->m_circle.radius(), 1e-3);
+    EXPECT_NEAR(frame.curvatureRate, 0.0, 1e-3);
+  }
+}
+}; // namespace Internal
+}; // namespace FrenetTransform
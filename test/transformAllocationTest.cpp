@@ -0,0 +1,414 @@
+// Eigen asserts on its heap allocations while set_is_malloc_allowed forbids
+// them, which requires assertions in release builds too
+#undef NDEBUG
+#undef EIGEN_NO_DEBUG
+#define EIGEN_RUNTIME_NO_MALLOC
+
+#include "frenetTransform/internal/circle.h"
+#include "frenetTransform/internal/constexprTypes.h"
+#include "frenetTransform/points.h"
+#include "frenetTransform/polychain.h"
+#include "frenetTransform/test/pathCircleTest.h"
+#include "frenetTransform/transform.h"
+
+#include <Eigen/Core>
+#include <algorithm>
+#include <cstdlib>
+#include <gtest/gtest.h>
+#include <math.h>
+#include <memory>
+#include <new>
+
+// number of allocations of operator new while counting
+static int s_numAllocations{};
+// whether to count allocations of operator new
+static bool s_countAllocations{};
+
+/**
+ * @brief Allocate and count memory for all replaced operator new overloads,
+ * such that all allocations are freed by std::free.
+ *
+ * @param size number of bytes to allocate.
+ * @param alignment alignment of the allocated memory.
+ * @return void* allocated memory.
+ */
+static void *allocate(std::size_t size,
+                      std::size_t alignment = __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+  if (s_countAllocations)
+    ++s_numAllocations;
+  // aligned_alloc requires sizes in multiples of the alignment
+  const std::size_t sizeAligned{(std::max<std::size_t>(size, 1) + alignment -
+                                 1) /
+                                alignment * alignment};
+  void *ptr{alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__
+                ? std::aligned_alloc(alignment, sizeAligned)
+                : std::malloc(sizeAligned)};
+  if (ptr)
+    return ptr;
+  throw std::bad_alloc{};
+}
+
+void *operator new(std::size_t size) { return allocate(size); }
+
+void *operator new[](std::size_t size) { return allocate(size); }
+
+void *operator new(std::size_t size, std::align_val_t alignment) {
+  return allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment) {
+  return allocate(size, static_cast<std::size_t>(alignment));
+}
+
+// kept out of line, since inlined into callers the pairing of operator new
+// with std::free is reported as mismatched
+[[gnu::noinline]] void operator delete(void *ptr) noexcept { std::free(ptr); }
+
+// remaining overloads release through the unsized one
+void operator delete[](void *ptr) noexcept { ::operator delete(ptr); }
+
+void operator delete(void *ptr, std::size_t) noexcept {
+  ::operator delete(ptr);
+}
+
+void operator delete[](void *ptr, std::size_t) noexcept {
+  ::operator delete(ptr);
+}
+
+void operator delete(void *ptr, std::align_val_t) noexcept {
+  ::operator delete(ptr);
+}
+
+void operator delete[](void *ptr, std::align_val_t) noexcept {
+  ::operator delete(ptr);
+}
+
+void operator delete(void *ptr, std::size_t, std::align_val_t) noexcept {
+  ::operator delete(ptr);
+}
+
+void operator delete[](void *ptr, std::size_t, std::align_val_t) noexcept {
+  ::operator delete(ptr);
+}
+
+namespace FrenetTransform {
+namespace Internal {
+template <typename NumQueries>
+class TransformAllocationTest : public PathCircleTest<NumQueries> {
+public:
+  using ArrayQueries = Eigen::Array<double, NumQueries::s_val, 1>;
+
+  static constexpr int s_numPoints{4096};
+
+protected:
+  const Circle<Eigen::Dynamic> m_circleApprox{5.0, {0.0, 0.0}, -M_PI};
+  const Transform<NumQueries::s_val> m_circleTransform{
+      std::make_shared<Polychain<Eigen::Dynamic, NumQueries::s_val>>(
+          m_circleApprox(Eigen::ArrayXd::LinSpaced(s_numPoints, 0.0, 2 * M_PI) *
+                         m_circleApprox.radius()))};
+  // path bound at compile time
+  const Transform<NumQueries::s_val,
+                  Polychain<Eigen::Dynamic, NumQueries::s_val>>
+      m_circleTransformStatic{
+          std::make_shared<Polychain<Eigen::Dynamic, NumQueries::s_val>>(
+              m_circleApprox(
+                  Eigen::ArrayXd::LinSpaced(s_numPoints, 0.0, 2 * M_PI) *
+                  m_circleApprox.radius()))};
+
+  const Points<NumQueries::s_val> m_posCartes{
+      this->m_transform.posCartes(this->m_posCircle)};
+  const Points<NumQueries::s_val> m_vel{
+      ArrayQueries::Random(this->s_numQueries),
+      ArrayQueries::Random(this->s_numQueries)};
+  const Points<NumQueries::s_val> m_acc{
+      ArrayQueries::Random(this->s_numQueries),
+      ArrayQueries::Random(this->s_numQueries)};
+
+  TransformWorkspace<NumQueries::s_val> m_workspace{this->s_numQueries};
+
+  /**
+   * @brief Provide results sized to the number of query points.
+   *
+   * @return Points<NumQueries::s_val> uninitialized results.
+   */
+  Points<NumQueries::s_val> results() const {
+    Points<NumQueries::s_val> result{};
+    result.resize(this->s_numQueries);
+    return result;
+  }
+
+  /**
+   * @brief Provide states sized to the number of query points.
+   *
+   * @return States<NumQueries::s_val> uninitialized states.
+   */
+  States<NumQueries::s_val> states() const {
+    return {results(), results(), results()};
+  }
+
+  /**
+   * @brief Count the heap allocations during "function".
+   *
+   * @tparam Function callable without arguments.
+   * @param function to count the heap allocations of.
+   * @return int number of heap allocations.
+   */
+  template <typename Function>
+  static int countAllocations(Function &&function) {
+    s_numAllocations = 0;
+    s_countAllocations = true;
+    Eigen::internal::set_is_malloc_allowed(false);
+    function();
+    Eigen::internal::set_is_malloc_allowed(true);
+    s_countAllocations = false;
+    return s_numAllocations;
+  }
+
+  void expectAllEqual(const Points<NumQueries::s_val> &estimate,
+                      const Points<NumQueries::s_val> &groundTruth) {
+    this->expectAllClose(estimate.x(), groundTruth.x(), limits::min());
+    this->expectAllClose(estimate.y(), groundTruth.y(), limits::min());
+  }
+};
+
+using TestParams = testing::Types<Integral<100>, Integral<Eigen::Dynamic>>;
+TYPED_TEST_SUITE(TransformAllocationTest, TestParams);
+
+TYPED_TEST(TransformAllocationTest, PosFrenet) {
+  auto result{this->results()};
+  EXPECT_EQ(this->countAllocations([this, &result]() {
+    this->m_circleTransform.posFrenet(this->m_posCartes, result,
+                                      this->m_workspace);
+  }),
+            0);
+
+  this->expectAllEqual(result,
+                       this->m_circleTransform.posFrenet(this->m_posCartes));
+}
+
+TYPED_TEST(TransformAllocationTest, PosFrenetHint) {
+  // track the previous results in place
+  auto result{this->m_circleTransform.posFrenet(this->m_posCartes)};
+  const auto hints{result.x()};
+  EXPECT_EQ(this->countAllocations([this, &result]() {
+    this->m_circleTransform.posFrenet(this->m_posCartes, result.x(), 5e-2,
+                                      result, this->m_workspace);
+  }),
+            0);
+
+  this->expectAllEqual(result, this->m_circleTransform.posFrenet(
+                                   this->m_posCartes, hints, 5e-2));
+}
+
+TYPED_TEST(TransformAllocationTest, PosCartes) {
+  auto result{this->results()};
+  EXPECT_EQ(this->countAllocations([this, &result]() {
+    this->m_circleTransform.posCartes(this->m_posFrenet, result,
+                                      this->m_workspace);
+  }),
+            0);
+
+  this->expectAllEqual(result,
+                       this->m_circleTransform.posCartes(this->m_posFrenet));
+}
+
+TYPED_TEST(TransformAllocationTest, VelFrenet) {
+  auto result{this->results()};
+  EXPECT_EQ(this->countAllocations([this, &result]() {
+    this->m_circleTransform.velFrenet(this->m_vel, this->m_posFrenet, result,
+                                      this->m_workspace);
+  }),
+            0);
+
+  this->expectAllEqual(result, this->m_circleTransform.velFrenet(
+                                   this->m_vel, this->m_posFrenet));
+}
+
+TYPED_TEST(TransformAllocationTest, VelCartes) {
+  auto result{this->results()};
+  EXPECT_EQ(this->countAllocations([this, &result]() {
+    this->m_circleTransform.velCartes(this->m_vel, this->m_posFrenet, result,
+                                      this->m_workspace);
+  }),
+            0);
+
+  this->expectAllEqual(result, this->m_circleTransform.velCartes(
+                                   this->m_vel, this->m_posFrenet));
+}
+
+TYPED_TEST(TransformAllocationTest, AccFrenet) {
+  auto result{this->results()};
+  EXPECT_EQ(this->countAllocations([this, &result]() {
+    this->m_circleTransform.accFrenet(this->m_acc, this->m_vel,
+                                      this->m_posFrenet, result,
+                                      this->m_workspace);
+  }),
+            0);
+
+  this->expectAllEqual(result,
+                       this->m_circleTransform.accFrenet(
+                           this->m_acc, this->m_vel, this->m_posFrenet));
+}
+
+TYPED_TEST(TransformAllocationTest, AccCartes) {
+  auto result{this->results()};
+  EXPECT_EQ(this->countAllocations([this, &result]() {
+    this->m_circleTransform.accCartes(this->m_acc, this->m_vel,
+                                      this->m_posFrenet, result,
+                                      this->m_workspace);
+  }),
+            0);
+
+  this->expectAllEqual(result,
+                       this->m_circleTransform.accCartes(
+                           this->m_acc, this->m_vel, this->m_posFrenet));
+}
+
+TYPED_TEST(TransformAllocationTest, StateFrenet) {
+  auto result{this->states()};
+  EXPECT_EQ(this->countAllocations([this, &result]() {
+    this->m_circleTransform.stateFrenet(this->m_posCartes, this->m_vel,
+                                        this->m_acc, result,
+                                        this->m_workspace);
+  }),
+            0);
+
+  const auto states{this->m_circleTransform.stateFrenet(
+      this->m_posCartes, this->m_vel, this->m_acc)};
+  this->expectAllEqual(result.pos, states.pos);
+  this->expectAllEqual(result.vel, states.vel);
+  this->expectAllEqual(result.acc, states.acc);
+}
+
+TYPED_TEST(TransformAllocationTest, StateFrenetHint) {
+  auto result{this->states()};
+  const auto hints{this->m_posFrenet.x()};
+  EXPECT_EQ(this->countAllocations([this, &result, &hints]() {
+    this->m_circleTransform.stateFrenet(this->m_posCartes, this->m_vel,
+                                        this->m_acc, hints, 5e-2, result,
+                                        this->m_workspace);
+  }),
+            0);
+
+  const auto states{this->m_circleTransform.stateFrenet(
+      this->m_posCartes, this->m_vel, this->m_acc, hints, 5e-2)};
+  this->expectAllEqual(result.pos, states.pos);
+  this->expectAllEqual(result.vel, states.vel);
+  this->expectAllEqual(result.acc, states.acc);
+}
+
+TYPED_TEST(TransformAllocationTest, StateCartes) {
+  auto result{this->states()};
+  EXPECT_EQ(this->countAllocations([this, &result]() {
+    this->m_circleTransform.stateCartes(this->m_posFrenet, this->m_vel,
+                                        this->m_acc, result,
+                                        this->m_workspace);
+  }),
+            0);
+
+  const auto states{this->m_circleTransform.stateCartes(
+      this->m_posFrenet, this->m_vel, this->m_acc)};
+  this->expectAllEqual(result.pos, states.pos);
+  this->expectAllEqual(result.vel, states.vel);
+  this->expectAllEqual(result.acc, states.acc);
+}
+
+TYPED_TEST(TransformAllocationTest, VelFrenetJacobians) {
+  auto result{this->results()};
+  // Jacobians sized by a first call
+  Jacobians<TypeParam::s_val> jacobians{};
+  this->m_circleTransform.velFrenet(this->m_vel, this->m_posFrenet, jacobians);
+  EXPECT_EQ(this->countAllocations([this, &result, &jacobians]() {
+    this->m_circleTransform.velFrenet(this->m_vel, this->m_posFrenet, result,
+                                      jacobians, this->m_workspace);
+  }),
+            0);
+
+  this->expectAllEqual(result, this->m_circleTransform.velFrenet(
+                                   this->m_vel, this->m_posFrenet));
+}
+
+TYPED_TEST(TransformAllocationTest, FrameSet) {
+  auto result{this->results()};
+  // frames sized by a first binding
+  auto frameSet{this->m_circleTransform.frameSet(this->m_posFrenet)};
+  EXPECT_EQ(this->countAllocations([this, &result, &frameSet]() {
+    this->m_circleTransform.frameSet(this->m_posFrenet, frameSet);
+    frameSet.accFrenet(this->m_acc, this->m_vel, result);
+  }),
+            0);
+
+  this->expectAllEqual(result, frameSet.accFrenet(this->m_acc, this->m_vel));
+}
+
+TYPED_TEST(TransformAllocationTest, StateFrenetSinglePoint) {
+  State<> result{};
+  EXPECT_EQ(this->countAllocations([this, &result]() {
+    result = this->m_circleTransform.stateFrenet(
+        this->m_posCartes(0), this->m_vel(0), this->m_acc(0));
+  }),
+            0);
+
+  const auto states{this->m_circleTransform.stateFrenet(
+      this->m_posCartes, this->m_vel, this->m_acc)};
+  EXPECT_NEAR(result.pos.x(), states.pos.x(0), 1e-10);
+  EXPECT_NEAR(result.vel.y(), states.vel.y(0), 1e-10);
+  EXPECT_NEAR(result.acc.x(), states.acc.x(0), 1e-10);
+}
+
+TYPED_TEST(TransformAllocationTest, StateCartesSinglePoint) {
+  State<> result{};
+  EXPECT_EQ(this->countAllocations([this, &result]() {
+    result = this->m_circleTransformStatic.stateCartes(
+        this->m_posFrenet(0), this->m_vel(0), this->m_acc(0));
+  }),
+            0);
+
+  const auto states{this->m_circleTransformStatic.stateCartes(
+      this->m_posFrenet, this->m_vel, this->m_acc)};
+  EXPECT_NEAR(result.pos.y(), states.pos.y(0), 1e-10);
+  EXPECT_NEAR(result.vel.x(), states.vel.x(0), 1e-10);
+  EXPECT_NEAR(result.acc.y(), states.acc.y(0), 1e-10);
+}
+
+TYPED_TEST(TransformAllocationTest, StateSinglePointCircle) {
+  // closed form circle evaluates single points without array fallbacks
+  State<> resultFrenet{};
+  State<> resultCartes{};
+  EXPECT_EQ(this->countAllocations([this, &resultFrenet, &resultCartes]() {
+    resultFrenet = this->m_transform.stateFrenet(
+        this->m_posCartes(0), this->m_vel(0), this->m_acc(0));
+    resultCartes = this->m_transform.stateCartes(
+        this->m_posFrenet(0), this->m_vel(0), this->m_acc(0));
+  }),
+            0);
+
+  const auto statesFrenet{this->m_transform.stateFrenet(
+      this->m_posCartes, this->m_vel, this->m_acc)};
+  EXPECT_NEAR(resultFrenet.pos.x(), statesFrenet.pos.x(0), 1e-12);
+  EXPECT_NEAR(resultFrenet.vel.y(), statesFrenet.vel.y(0), 1e-12);
+  EXPECT_NEAR(resultFrenet.acc.x(), statesFrenet.acc.x(0), 1e-12);
+  const auto statesCartes{this->m_transform.stateCartes(
+      this->m_posFrenet, this->m_vel, this->m_acc)};
+  EXPECT_NEAR(resultCartes.pos.y(), statesCartes.pos.y(0), 1e-12);
+  EXPECT_NEAR(resultCartes.vel.x(), statesCartes.vel.x(0), 1e-12);
+  EXPECT_NEAR(resultCartes.acc.y(), statesCartes.acc.y(0), 1e-12);
+}
+
+TYPED_TEST(TransformAllocationTest, StateFrenetStatic) {
+  auto result{this->states()};
+  EXPECT_EQ(this->countAllocations([this, &result]() {
+    this->m_circleTransformStatic.stateFrenet(this->m_posCartes, this->m_vel,
+                                              this->m_acc, result,
+                                              this->m_workspace);
+  }),
+            0);
+
+  const auto states{this->m_circleTransformStatic.stateFrenet(
+      this->m_posCartes, this->m_vel, this->m_acc)};
+  this->expectAllEqual(result.pos, states.pos);
+  this->expectAllEqual(result.vel, states.vel);
+  this->expectAllEqual(result.acc, states.acc);
+}
+}; // namespace Internal
+}; // namespace FrenetTransform